@@ -0,0 +1,30 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "RollWireCalculator.h"
+#include "RollWireCalibration.h"
+
+// 보정 처리량 벤치마크
+// 인자: 표본 수
+
+static void BM_CalibrationFit(benchmark::State& state) {
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    RollWireCalculator calculator(1.0, 50.0);
+    std::vector<double> rotations(count);
+    std::vector<double> lengths(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rotations[i] = 36000.0 * (i + 1) / count;
+    }
+    calculator.calculateLengthsFromRotations(rotations.data(), lengths.data(),
+                                             count);
+
+    for (auto _ : state) {
+        RollWireCalibration::Result result = RollWireCalibration::fit(
+            lengths.data(), rotations.data(), count);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CalibrationFit)
+    ->Arg(1000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "FixedPoint.h"
+#include "RollWireCalculator.h"
+#include "RollWireMath.h"
+
+// 수치 형식별 길이 → 회전량 일괄 변환 처리량
+// 인자: 표본 수
+
+template <typename Scalar>
+static void BM_RotationsFromLengths(benchmark::State& state) {
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<Scalar> lengths(count);
+    std::vector<Scalar> rotations(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        lengths[i] = Scalar(5.0 * (i + 1) / count);
+    }
+    const Scalar thickness(1.0);
+    const Scalar radius(50.0);
+
+    for (auto _ : state) {
+        RollWireMath<Scalar>::rotationsFromLengths(
+            thickness, radius, lengths.data(), rotations.data(), count);
+        benchmark::DoNotOptimize(rotations.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_RotationsFromLengths, float)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_RotationsFromLengths, double)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_RotationsFromLengths, Fixed32)->Arg(4096);
+
+template <typename Scalar>
+static void BM_LengthsFromRotations(benchmark::State& state) {
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<Scalar> rotations(count);
+    std::vector<Scalar> lengths(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rotations[i] = Scalar(36000.0 * (i + 1) / count);
+    }
+    const Scalar thickness(1.0);
+    const Scalar radius(50.0);
+
+    for (auto _ : state) {
+        RollWireMath<Scalar>::lengthsFromRotations(
+            thickness, radius, rotations.data(), lengths.data(), count);
+        benchmark::DoNotOptimize(lengths.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_LengthsFromRotations, float)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_LengthsFromRotations, double)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_LengthsFromRotations, Fixed32)->Arg(4096);
+
+// 스칼라 형식별 계산기 일괄 변환 처리량과 정확도
+// 정확도: long double 계산기 기준 최대 상대 오차 (counters["maxRelError"])
+// 인자: 표본 수
+
+template <typename Scalar>
+static void BM_CalculatorRotationsFromLengths(benchmark::State& state) {
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    BasicRollWireCalculator<Scalar> calculator(Scalar(1.0), Scalar(50.0));
+    BasicRollWireCalculator<long double> reference(1.0L, 50.0L);
+    std::vector<Scalar> lengths(count);
+    std::vector<Scalar> rotations(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        lengths[i] = Scalar(5.0 * (i + 1) / count);
+    }
+
+    for (auto _ : state) {
+        calculator.calculateRotationsFromLengths(lengths.data(),
+                                                 rotations.data(), count);
+        benchmark::DoNotOptimize(rotations.data());
+        benchmark::ClobberMemory();
+    }
+
+    long double maxRelError = 0.0L;
+    for (std::size_t i = 0; i < count; ++i) {
+        long double expected = reference.calculateRotationFromLength(
+            5.0L * (i + 1) / count);
+        maxRelError = std::max(
+            maxRelError, std::abs(rotations[i] - expected) / expected);
+    }
+    state.counters["maxRelError"] = static_cast<double>(maxRelError);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_CalculatorRotationsFromLengths, float)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_CalculatorRotationsFromLengths, double)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_CalculatorRotationsFromLengths, long double)->Arg(4096);
+
+template <typename Scalar>
+static void BM_CalculatorLengthsFromRotations(benchmark::State& state) {
+    std::size_t count = static_cast<std::size_t>(state.range(0));
+    BasicRollWireCalculator<Scalar> calculator(Scalar(1.0), Scalar(50.0));
+    BasicRollWireCalculator<long double> reference(1.0L, 50.0L);
+    std::vector<Scalar> rotations(count);
+    std::vector<Scalar> lengths(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rotations[i] = Scalar(36000.0 * (i + 1) / count);
+    }
+
+    for (auto _ : state) {
+        calculator.calculateLengthsFromRotations(rotations.data(),
+                                                 lengths.data(), count);
+        benchmark::DoNotOptimize(lengths.data());
+        benchmark::ClobberMemory();
+    }
+
+    long double maxRelError = 0.0L;
+    for (std::size_t i = 0; i < count; ++i) {
+        long double expected = reference.calculateLengthFromRotation(
+            36000.0L * (i + 1) / count);
+        maxRelError = std::max(
+            maxRelError, std::abs(lengths[i] - expected) / expected);
+    }
+    state.counters["maxRelError"] = static_cast<double>(maxRelError);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_CalculatorLengthsFromRotations, float)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_CalculatorLengthsFromRotations, double)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_CalculatorLengthsFromRotations, long double)->Arg(4096);
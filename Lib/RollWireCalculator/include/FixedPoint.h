@@ -0,0 +1,109 @@
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+#include <cstdint>
+
+/**
+ * @brief Q 형식 고정소수점 수 (64비트 부호 있는 정수, 소수부 FracBits 비트)
+ *
+ * 부동소수점 연산이 느린 드라이브에서 프로파일을 계산하거나, 기계마다
+ * 비트 단위로 같은 결과가 필요할 때 사용합니다. 모든 연산은 정수 연산이며
+ * 곱셈/나눗셈은 128비트 중간값을 사용하고 0 방향으로 버림합니다.
+ * sqrt()는 정수 제곱근(비트 단위 이분법)으로 계산합니다.
+ *
+ * 표현 범위: ±2^(63 - FracBits), 분해능: 2^-FracBits
+ * 예) FixedPoint<32> (Q31.32): ±2.1e9, 분해능 2.3e-10
+ */
+template <int FracBits>
+class FixedPoint {
+    static_assert(FracBits > 0 && FracBits < 62, "FracBits must be in 1..61");
+
+public:
+    constexpr FixedPoint() : raw(0) {}
+
+    // double → 고정소수점 (가장 가까운 값으로 반올림)
+    constexpr explicit FixedPoint(double value)
+        : raw(static_cast<int64_t>(value * ONE + (value < 0 ? -0.5 : 0.5))) {}
+    constexpr explicit FixedPoint(int value)
+        : raw(static_cast<int64_t>(value) * ONE) {}
+
+    static constexpr FixedPoint fromRaw(int64_t value) {
+        FixedPoint result;
+        result.raw = value;
+        return result;
+    }
+
+    constexpr int64_t getRaw() const { return raw; }
+    constexpr explicit operator double() const {
+        return static_cast<double>(raw) / ONE;
+    }
+
+    // 분해능 (1 LSB)
+    static constexpr double resolution() { return 1.0 / ONE; }
+
+    constexpr FixedPoint operator-() const { return fromRaw(-raw); }
+    constexpr FixedPoint operator+(FixedPoint other) const {
+        return fromRaw(raw + other.raw);
+    }
+    constexpr FixedPoint operator-(FixedPoint other) const {
+        return fromRaw(raw - other.raw);
+    }
+    constexpr FixedPoint operator*(FixedPoint other) const {
+        return fromRaw(static_cast<int64_t>(
+            (static_cast<__int128>(raw) * other.raw) / ONE));
+    }
+    constexpr FixedPoint operator/(FixedPoint other) const {
+        return fromRaw(static_cast<int64_t>(
+            (static_cast<__int128>(raw) * ONE) / other.raw));
+    }
+
+    FixedPoint& operator+=(FixedPoint other) { return *this = *this + other; }
+    FixedPoint& operator-=(FixedPoint other) { return *this = *this - other; }
+    FixedPoint& operator*=(FixedPoint other) { return *this = *this * other; }
+    FixedPoint& operator/=(FixedPoint other) { return *this = *this / other; }
+
+    constexpr bool operator==(FixedPoint other) const { return raw == other.raw; }
+    constexpr bool operator!=(FixedPoint other) const { return raw != other.raw; }
+    constexpr bool operator<(FixedPoint other) const { return raw < other.raw; }
+    constexpr bool operator>(FixedPoint other) const { return raw > other.raw; }
+    constexpr bool operator<=(FixedPoint other) const { return raw <= other.raw; }
+    constexpr bool operator>=(FixedPoint other) const { return raw >= other.raw; }
+
+    /**
+     * @brief 정수 제곱근 (음수 입력은 0)
+     *
+     * sqrt(raw / 2^F) × 2^F = sqrt(raw × 2^F) 이므로 raw를 F비트 올린
+     * 128비트 정수의 제곱근을 버림으로 구합니다.
+     */
+    friend FixedPoint sqrt(FixedPoint value) {
+        if (value.raw <= 0) {
+            return FixedPoint();
+        }
+        unsigned __int128 n = static_cast<unsigned __int128>(value.raw) << FracBits;
+        unsigned __int128 root = 0;
+        // 시작 비트: n 이하인 가장 큰 4의 거듭제곱 (최상위 비트에서 바로 계산)
+        uint64_t high = static_cast<uint64_t>(n >> 64);
+        int topBit = high != 0 ? 127 - __builtin_clzll(high)
+                               : 63 - __builtin_clzll(static_cast<uint64_t>(n));
+        unsigned __int128 bit = static_cast<unsigned __int128>(1) << (topBit & ~1);
+        while (bit != 0) {
+            if (n >= root + bit) {
+                n -= root + bit;
+                root = (root >> 1) + bit;
+            } else {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return fromRaw(static_cast<int64_t>(root));
+    }
+
+private:
+    static constexpr int64_t ONE = static_cast<int64_t>(1) << FracBits;
+    int64_t raw;
+};
+
+// 기본 고정소수점 형식: Q31.32
+using Fixed32 = FixedPoint<32>;
+
+#endif // FIXEDPOINT_H
@@ -1,6 +1,7 @@
 #ifndef ROLLWIRECALCULATOR_H
 #define ROLLWIRECALCULATOR_H
 
+#include <cstddef>
 #include <stdexcept>
 
 /**
@@ -15,28 +16,43 @@
  * - 연속 증가 모델: r(θ) = innerRadius + (θ/360) * wireThickness
  * - 양방향 변환 지원 (길이 ↔ 회전량)
  * - 역함수 관계 보장 (부동소수점 오차 범위 내)
+ *
+ * 변환 식은 RollWireMath<Scalar>를 그대로 사용하고, 이 클래스는 입력 검증과
+ * 형상 보관을 더합니다. 스칼라 형식은 float(일괄 SIMD 경로), double(기본,
+ * RollWireCalculator), long double(검증 기준값)로 명시적 인스턴스화되어
+ * 있고, Fixed32(고정소수점 드라이브)는 RollWireCalculatorFixed.h에서 선택해
+ * 사용합니다.
  */
-class RollWireCalculator {
+template <typename Scalar>
+class BasicRollWireCalculator {
 private:
-    double wireThickness;   // mm - 와이어 두께
-    double innerRadius;     // mm - 롤의 내경 반지름
+    Scalar wireThickness;   // mm - 와이어 두께
+    Scalar innerRadius;     // mm - 롤의 내경 반지름
 
 public:
     /**
-     * @brief RollWireCalculator 생성자
+     * @brief 일괄 변환의 블록 크기 (256비트 레지스터 하나에 들어가는 원소 수)
+     *
+     * float 8, double 4, long double 2, Fixed32 4
+     */
+    static constexpr std::size_t BATCH_LANES =
+        sizeof(Scalar) < 32 ? 32 / sizeof(Scalar) : 1;
+
+    /**
+     * @brief BasicRollWireCalculator 생성자
      *
      * @param thickness 와이어의 두께 (mm, 0보다 커야 함)
      * @param radius 롤의 내경 반지름 (mm, 0보다 커야 함)
      * @throws std::invalid_argument thickness 또는 radius가 0 이하인 경우
      */
-    RollWireCalculator(double thickness, double radius);
+    BasicRollWireCalculator(Scalar thickness, Scalar radius);
 
     /**
      * @brief 와이어 두께를 조회합니다
      *
-     * @return double 와이어 두께 (mm)
+     * @return Scalar 와이어 두께 (mm)
      */
-    double getWireThickness() const;
+    Scalar getWireThickness() const;
 
     /**
      * @brief 롤의 내경 반지름을 설정합니다
@@ -44,26 +60,28 @@ public:
      * @param radius 새로운 롤 내경 반지름 (mm, 0보다 커야 함)
      * @throws std::invalid_argument radius가 0 이하인 경우
      */
-    void setInnerRadius(double radius);
+    void setInnerRadius(Scalar radius);
 
     /**
      * @brief 롤의 내경 반지름을 조회합니다
      *
-     * @return double 롤 내경 반지름 (mm)
+     * @return Scalar 롤 내경 반지름 (mm)
      */
-    double getInnerRadius() const;
+    Scalar getInnerRadius() const;
 
     /**
      * @brief 주어진 와이어 길이에 해당하는 롤의 회전량을 계산합니다
      *
      * 와이어가 롤에 감기면서 유효 반지름이 증가하는 연속 증가 모델을 사용하여
-     * 정확한 회전량을 계산합니다. 수치 적분 방법을 사용합니다.
+     * 정확한 회전량을 계산합니다. 2차 방정식의 양의 근을 뺄셈 상쇄가 없는
+     * 2c / (b + sqrt(b² - 4ac)) 형태로 구하므로 float에서도 짧은 길이의
+     * 상대 오차가 커지지 않습니다.
      *
      * @param length 와이어 길이 (m, 미터, 0 이상이어야 함)
-     * @return double 롤의 회전량 (도, degrees)
+     * @return Scalar 롤의 회전량 (도, degrees)
      * @throws std::invalid_argument length가 음수인 경우
      */
-    double calculateRotationFromLength(double length) const;
+    Scalar calculateRotationFromLength(Scalar length) const;
 
     /**
      * @brief 주어진 롤의 회전량에 해당하는 와이어 길이를 계산합니다
@@ -72,10 +90,47 @@ public:
      * 정확한 와이어 길이를 계산합니다. 적분 공식을 사용합니다.
      *
      * @param rotation 롤의 회전량 (도, degrees, 0 이상이어야 함)
-     * @return double 와이어 길이 (m, 미터)
+     * @return Scalar 와이어 길이 (m, 미터)
      * @throws std::invalid_argument rotation이 음수인 경우
      */
-    double calculateLengthFromRotation(double rotation) const;
+    Scalar calculateLengthFromRotation(Scalar rotation) const;
+
+    /**
+     * @brief 여러 회전량에 해당하는 와이어 길이를 한 번에 계산합니다
+     *
+     * 입력 전체를 BATCH_LANES개 단위 블록으로 먼저 검증한 뒤, 분기 없는
+     * RollWireMath 일괄 루프로 변환하여 컴파일러가 벡터화할 수 있습니다.
+     * 예외 발생 시 lengths는 변경되지 않습니다.
+     *
+     * @param rotations 롤의 회전량 배열 (도, degrees, 모두 0 이상이어야 함)
+     * @param lengths 결과 와이어 길이 배열 (m, 미터, count개 이상)
+     * @param count 변환할 개수
+     * @throws std::invalid_argument rotations 중 음수가 있는 경우
+     */
+    void calculateLengthsFromRotations(const Scalar* rotations, Scalar* lengths,
+                                       std::size_t count) const;
+
+    /**
+     * @brief 여러 와이어 길이에 해당하는 회전량을 한 번에 계산합니다
+     *
+     * calculateRotationFromLength()와 같은 식을 분기 없는 루프로 처리합니다.
+     * 입력 전체를 먼저 검증하므로 예외 발생 시 rotations는 변경되지 않습니다.
+     *
+     * @param lengths 와이어 길이 배열 (m, 미터, 모두 0 이상이어야 함)
+     * @param rotations 결과 회전량 배열 (도, degrees, count개 이상)
+     * @param count 변환할 개수
+     * @throws std::invalid_argument lengths 중 음수가 있는 경우
+     */
+    void calculateRotationsFromLengths(const Scalar* lengths, Scalar* rotations,
+                                       std::size_t count) const;
 };
 
+// 명시적 인스턴스화 (구현: RollWireCalculator.cpp)
+extern template class BasicRollWireCalculator<float>;
+extern template class BasicRollWireCalculator<double>;
+extern template class BasicRollWireCalculator<long double>;
+
+// 기본 계산기 (double)
+using RollWireCalculator = BasicRollWireCalculator<double>;
+
 #endif // ROLLWIRECALCULATOR_H
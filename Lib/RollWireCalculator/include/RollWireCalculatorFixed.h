@@ -0,0 +1,19 @@
+#ifndef ROLLWIRECALCULATORFIXED_H
+#define ROLLWIRECALCULATORFIXED_H
+
+#include "FixedPoint.h"
+#include "RollWireCalculator.h"
+
+/**
+ * @brief 고정소수점(Fixed32) 계산기 (선택 사용)
+ *
+ * FixedPoint는 __int128과 GCC/Clang 내장 함수를 사용하므로, 기본 계산기
+ * 헤더와 분리하여 필요한 곳에서만 포함합니다. 이 헤더를 포함하지 않는
+ * double 계산기 사용자는 컴파일러 확장에 의존하지 않습니다.
+ * (구현: RollWireCalculatorFixed.cpp, GCC/Clang 빌드에서만 라이브러리에 포함)
+ */
+extern template class BasicRollWireCalculator<Fixed32>;
+
+using FixedRollWireCalculator = BasicRollWireCalculator<Fixed32>;
+
+#endif // ROLLWIRECALCULATORFIXED_H
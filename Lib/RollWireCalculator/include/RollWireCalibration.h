@@ -0,0 +1,97 @@
+#ifndef ROLLWIRECALIBRATION_H
+#define ROLLWIRECALIBRATION_H
+
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * @brief 기록된 (길이, 회전량) 쌍으로 와이어 두께와 롤 내경을 추정합니다
+ *
+ * RollWireCalculator의 연속 증가 모델을 회전수 n = θ/360 으로 쓰면
+ *
+ *   L(n) = α × n + β × n²   [m]
+ *   α = 2π × innerRadius / 1000,  β = π × wireThickness / 1000
+ *
+ * 으로 계수에 대해 선형입니다. 절편 없는 최소제곱의 정규 방정식은 다섯 개의
+ * 합(Σn², Σn³, Σn⁴, ΣLn, ΣLn²)만으로 닫힌 형태로 풀리므로, 표본은 합에
+ * 누적만 하고 저장하지 않습니다. 여러 번에 나누어 누적하거나(백그라운드
+ * 보정) 다른 누적기와 합칠(merge) 수 있습니다.
+ */
+class RollWireCalibration {
+public:
+    /**
+     * @brief 보정 결과
+     */
+    struct Result {
+        double wireThickness;     // mm - 추정 와이어 두께
+        double innerRadius;       // mm - 추정 롤 내경 반지름
+        double rmsResidual;       // m - 길이 잔차의 RMS
+        std::size_t sampleCount;  // 사용한 표본 수
+    };
+
+    RollWireCalibration();
+
+    /**
+     * @brief 표본 하나를 누적합니다
+     *
+     * @param length 와이어 길이 (m, 0 이상)
+     * @param rotation 롤 회전량 (도, 0 이상)
+     * @throws std::invalid_argument 음수이거나 유한하지 않은 값인 경우
+     */
+    void addSample(double length, double rotation);
+
+    /**
+     * @brief 표본 배열을 한 번에 누적합니다
+     *
+     * 입력 전체를 먼저 검증하므로 예외 발생 시 누적값은 변경되지 않습니다.
+     * 누적 루프는 분기 없이 4개의 독립 부분합으로 처리합니다.
+     *
+     * @param lengths 와이어 길이 배열 (m)
+     * @param rotations 롤 회전량 배열 (도)
+     * @param count 표본 수
+     * @throws std::invalid_argument 음수이거나 유한하지 않은 값이 있는 경우
+     */
+    void addSamples(const double* lengths, const double* rotations,
+                    std::size_t count);
+
+    /**
+     * @brief 다른 누적기의 표본을 합칩니다 (분할 처리 결과 병합)
+     */
+    void merge(const RollWireCalibration& other);
+
+    /**
+     * @brief 누적된 표본으로 두께와 내경을 계산합니다
+     *
+     * @return Result 추정 결과
+     * @throws std::invalid_argument 표본이 부족하거나(서로 다른 0이 아닌
+     *         회전량 2개 미만) 추정값이 0 이하인 경우
+     */
+    Result solve() const;
+
+    /**
+     * @brief 누적값을 초기화합니다
+     */
+    void reset();
+
+    std::size_t getSampleCount() const;
+
+    /**
+     * @brief 표본 배열에서 바로 두께와 내경을 추정합니다
+     *
+     * @throws std::invalid_argument addSamples(), solve()와 같은 조건
+     */
+    static Result fit(const double* lengths, const double* rotations,
+                      std::size_t count);
+
+private:
+    // 회전수 n과 길이 L의 누적 합
+    double sumN2;    // Σn²
+    double sumN3;    // Σn³
+    double sumN4;    // Σn⁴
+    double sumLN;    // ΣL·n
+    double sumLN2;   // ΣL·n²
+    double sumL2;    // ΣL² (잔차 계산용)
+    std::size_t count;
+};
+
+#endif // ROLLWIRECALIBRATION_H
@@ -0,0 +1,69 @@
+#ifndef ROLLWIREMATH_H
+#define ROLLWIREMATH_H
+
+#include <cmath>
+#include <cstddef>
+
+/**
+ * @brief 연속 증가 모델의 길이 ↔ 회전량 변환 커널 (수치 형식 템플릿)
+ *
+ * BasicRollWireCalculator가 사용하는 변환 식을 Scalar 형식(float, double,
+ * long double, FixedPoint<F>)으로 계산합니다. 입력 검증은 하지 않으며 호출 측에서 0 이상
+ * 값만 전달해야 합니다. Scalar는 사칙연산, 비교, double에서의 명시적 생성,
+ * sqrt()(std 또는 ADL)를 지원해야 합니다.
+ *
+ * 단위: 두께/반지름 mm, 길이 m, 회전량 도
+ */
+template <typename Scalar>
+struct RollWireMath {
+    static Scalar pi() { return Scalar(3.14159265358979323846); }
+
+    /**
+     * @brief 길이(m) → 회전량(도)
+     *
+     * (t/720)·θ² + r·θ - c = 0, c = L_mm × 180/π 의 양의 근을
+     * θ = 2c / (r + sqrt(r² + t·c/180)) 형태로 계산합니다.
+     * (-b + sqrt(D)) / 2a 형태와 같은 값이지만, 작은 a로 나누지 않고 뺄셈
+     * 상쇄가 없어 float/고정소수점에서 오차가 작습니다.
+     */
+    static Scalar rotationFromLength(Scalar thickness, Scalar radius,
+                                     Scalar length) {
+        using std::sqrt;
+        Scalar c = length * Scalar(1000.0 * 180.0 / 3.14159265358979323846);
+        Scalar root = sqrt(radius * radius + thickness * c / Scalar(180.0));
+        return Scalar(2.0) * c / (radius + root);
+    }
+
+    /**
+     * @brief 회전량(도) → 길이(m)
+     *
+     * L = θ × (r + t·θ/720) × (π/180) / 1000
+     * 유효 반지름(mm)을 먼저 구해 작은 계수끼리의 곱을 피합니다.
+     * (고정소수점에서 2π/360/1000 같은 작은 상수는 유효 자릿수가 적음)
+     */
+    static Scalar lengthFromRotation(Scalar thickness, Scalar radius,
+                                     Scalar rotation) {
+        Scalar meanRadius = radius + thickness * rotation / Scalar(720.0);
+        return rotation * meanRadius * Scalar(3.14159265358979323846 / 180.0) /
+               Scalar(1000.0);
+    }
+
+    // 일괄 변환 (분기 없는 루프)
+    static void lengthsFromRotations(Scalar thickness, Scalar radius,
+                                     const Scalar* rotations, Scalar* lengths,
+                                     std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            lengths[i] = lengthFromRotation(thickness, radius, rotations[i]);
+        }
+    }
+
+    static void rotationsFromLengths(Scalar thickness, Scalar radius,
+                                     const Scalar* lengths, Scalar* rotations,
+                                     std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            rotations[i] = rotationFromLength(thickness, radius, lengths[i]);
+        }
+    }
+};
+
+#endif // ROLLWIREMATH_H
@@ -0,0 +1,4 @@
+#include "RollWireCalculatorFixed.h"
+#include "RollWireCalculatorImpl.h"
+
+template class BasicRollWireCalculator<Fixed32>;
@@ -0,0 +1,105 @@
+#ifndef ROLLWIRECALCULATORIMPL_H
+#define ROLLWIRECALCULATORIMPL_H
+
+#include "RollWireCalculator.h"
+#include "RollWireMath.h"
+
+// BasicRollWireCalculator 멤버 정의 (라이브러리 내부 전용)
+// 명시적 인스턴스화하는 소스 파일(RollWireCalculator.cpp,
+// RollWireCalculatorFixed.cpp)에서만 포함합니다.
+//
+// 변환 식은 RollWireMath에 한 곳만 두고, 이 클래스는 입력 검증과
+// 형상(두께, 내경) 보관만 담당합니다.
+
+template <typename Scalar>
+BasicRollWireCalculator<Scalar>::BasicRollWireCalculator(Scalar thickness,
+                                                         Scalar radius)
+    : wireThickness(thickness), innerRadius(radius) {
+    if (thickness <= Scalar(0.0)) {
+        throw std::invalid_argument("Wire thickness must be positive");
+    }
+    if (radius <= Scalar(0.0)) {
+        throw std::invalid_argument("Inner radius must be positive");
+    }
+}
+
+template <typename Scalar>
+Scalar BasicRollWireCalculator<Scalar>::getWireThickness() const {
+    return wireThickness;
+}
+
+template <typename Scalar>
+void BasicRollWireCalculator<Scalar>::setInnerRadius(Scalar radius) {
+    if (radius <= Scalar(0.0)) {
+        throw std::invalid_argument("Inner radius must be positive");
+    }
+    innerRadius = radius;
+}
+
+template <typename Scalar>
+Scalar BasicRollWireCalculator<Scalar>::getInnerRadius() const {
+    return innerRadius;
+}
+
+template <typename Scalar>
+Scalar BasicRollWireCalculator<Scalar>::calculateRotationFromLength(
+    Scalar length) const {
+    if (length < Scalar(0.0)) {
+        throw std::invalid_argument("Length must be non-negative");
+    }
+
+    // 연속 증가 모델: r(θ) = innerRadius + (θ/360) × wireThickness
+    // L = ∫[0→θ] r(t) × (2π/360) dt 를 θ에 대해 푼 2차 방정식의 양의 근
+    return RollWireMath<Scalar>::rotationFromLength(wireThickness, innerRadius,
+                                                    length);
+}
+
+template <typename Scalar>
+Scalar BasicRollWireCalculator<Scalar>::calculateLengthFromRotation(
+    Scalar rotation) const {
+    if (rotation < Scalar(0.0)) {
+        throw std::invalid_argument("Rotation must be non-negative");
+    }
+
+    return RollWireMath<Scalar>::lengthFromRotation(wireThickness, innerRadius,
+                                                    rotation);
+}
+
+template <typename Scalar>
+void BasicRollWireCalculator<Scalar>::calculateLengthsFromRotations(
+    const Scalar* rotations, Scalar* lengths, std::size_t count) const {
+    // 검증도 블록 단위로 (블록 안에서는 분기 없이 OR)
+    const std::size_t blockEnd = count - count % BATCH_LANES;
+    for (std::size_t i = 0; i < blockEnd; i += BATCH_LANES) {
+        bool negative = false;
+        for (std::size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            negative |= rotations[i + lane] < Scalar(0.0);
+        }
+        if (negative) {
+            throw std::invalid_argument("Rotation must be non-negative");
+        }
+    }
+    for (std::size_t i = blockEnd; i < count; ++i) {
+        if (rotations[i] < Scalar(0.0)) {
+            throw std::invalid_argument("Rotation must be non-negative");
+        }
+    }
+
+    RollWireMath<Scalar>::lengthsFromRotations(wireThickness, innerRadius,
+                                               rotations, lengths, count);
+}
+
+template <typename Scalar>
+void BasicRollWireCalculator<Scalar>::calculateRotationsFromLengths(
+    const Scalar* lengths, Scalar* rotations, std::size_t count) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (lengths[i] < Scalar(0.0)) {
+            throw std::invalid_argument("Length must be non-negative");
+        }
+    }
+
+    RollWireMath<Scalar>::rotationsFromLengths(wireThickness, innerRadius,
+                                               lengths, rotations, count);
+}
+
+#endif // ROLLWIRECALCULATORIMPL_H
@@ -0,0 +1,137 @@
+#include "RollWireCalibration.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const std::size_t LANES = 4;  // 독립 부분합 수
+
+void validateSample(double length, double rotation) {
+    if (!std::isfinite(length) || length < 0.0) {
+        throw std::invalid_argument("Length must be finite and non-negative");
+    }
+    if (!std::isfinite(rotation) || rotation < 0.0) {
+        throw std::invalid_argument("Rotation must be finite and non-negative");
+    }
+}
+
+}  // namespace
+
+RollWireCalibration::RollWireCalibration() {
+    reset();
+}
+
+void RollWireCalibration::addSample(double length, double rotation) {
+    addSamples(&length, &rotation, 1);
+}
+
+void RollWireCalibration::addSamples(const double* lengths,
+                                     const double* rotations,
+                                     std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        validateSample(lengths[i], rotations[i]);
+    }
+
+    // 회전수 n = θ/360 으로 정규화 (θ⁴ 누적 시 크기를 줄여 정밀도 유지)
+    // 레인별 부분합은 서로 의존하지 않으므로 파이프라인/벡터 레지스터를
+    // 채울 수 있음
+    double n2[LANES] = {}, n3[LANES] = {}, n4[LANES] = {};
+    double ln[LANES] = {}, ln2[LANES] = {}, l2[LANES] = {};
+    const double turnsPerDegree = 1.0 / 360.0;
+
+    std::size_t i = 0;
+    for (; i + LANES <= n; i += LANES) {
+        for (std::size_t lane = 0; lane < LANES; ++lane) {
+            double t = rotations[i + lane] * turnsPerDegree;
+            double l = lengths[i + lane];
+            double t2 = t * t;
+            n2[lane] += t2;
+            n3[lane] += t2 * t;
+            n4[lane] += t2 * t2;
+            ln[lane] += l * t;
+            ln2[lane] += l * t2;
+            l2[lane] += l * l;
+        }
+    }
+    for (; i < n; ++i) {
+        double t = rotations[i] * turnsPerDegree;
+        double l = lengths[i];
+        double t2 = t * t;
+        n2[0] += t2;
+        n3[0] += t2 * t;
+        n4[0] += t2 * t2;
+        ln[0] += l * t;
+        ln2[0] += l * t2;
+        l2[0] += l * l;
+    }
+
+    for (std::size_t lane = 0; lane < LANES; ++lane) {
+        sumN2 += n2[lane];
+        sumN3 += n3[lane];
+        sumN4 += n4[lane];
+        sumLN += ln[lane];
+        sumLN2 += ln2[lane];
+        sumL2 += l2[lane];
+    }
+    count += n;
+}
+
+void RollWireCalibration::merge(const RollWireCalibration& other) {
+    sumN2 += other.sumN2;
+    sumN3 += other.sumN3;
+    sumN4 += other.sumN4;
+    sumLN += other.sumLN;
+    sumLN2 += other.sumLN2;
+    sumL2 += other.sumL2;
+    count += other.count;
+}
+
+RollWireCalibration::Result RollWireCalibration::solve() const {
+    // 정규 방정식
+    //   [Σn²  Σn³] [α]   [ΣLn ]
+    //   [Σn³  Σn⁴] [β] = [ΣLn²]
+    double det = sumN2 * sumN4 - sumN3 * sumN3;
+    if (count < 2 || !(det > 1e-12 * sumN2 * sumN4)) {
+        throw std::invalid_argument(
+            "Calibration needs at least two distinct non-zero rotations");
+    }
+    double alpha = (sumLN * sumN4 - sumLN2 * sumN3) / det;
+    double beta = (sumLN2 * sumN2 - sumLN * sumN3) / det;
+
+    // α = 2π × innerRadius / 1000,  β = π × wireThickness / 1000
+    Result result;
+    result.innerRadius = alpha * 1000.0 / (2.0 * M_PI);
+    result.wireThickness = beta * 1000.0 / M_PI;
+    if (!(result.innerRadius > 0.0) || !(result.wireThickness > 0.0)) {
+        throw std::invalid_argument(
+            "Calibration data does not fit a positive thickness and radius");
+    }
+
+    // 최소제곱해에서 잔차 제곱합 = ΣL² - (α·ΣLn + β·ΣLn²)
+    double residual = sumL2 - (alpha * sumLN + beta * sumLN2);
+    result.rmsResidual = std::sqrt(std::max(0.0, residual) / count);
+    result.sampleCount = count;
+    return result;
+}
+
+void RollWireCalibration::reset() {
+    sumN2 = 0.0;
+    sumN3 = 0.0;
+    sumN4 = 0.0;
+    sumLN = 0.0;
+    sumLN2 = 0.0;
+    sumL2 = 0.0;
+    count = 0;
+}
+
+std::size_t RollWireCalibration::getSampleCount() const {
+    return count;
+}
+
+RollWireCalibration::Result RollWireCalibration::fit(const double* lengths,
+                                                     const double* rotations,
+                                                     std::size_t count) {
+    RollWireCalibration calibration;
+    calibration.addSamples(lengths, rotations, count);
+    return calibration.solve();
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include "FixedPoint.h"
+#include "RollWireCalculator.h"
+#include "RollWireCalculatorFixed.h"
+#include "RollWireMath.h"
+
+// Phase 12.1: Q 형식 고정소수점
+TEST(FixedPointTest, ArithmeticMatchesDoubleWithinResolution) {
+    // 사칙연산 결과는 double 결과와 1 LSB 이내로 일치한다
+    const double a = 123.456789;
+    const double b = -7.25;
+    const double lsb = Fixed32::resolution();
+
+    EXPECT_NEAR(a + b, static_cast<double>(Fixed32(a) + Fixed32(b)), 2 * lsb);
+    EXPECT_NEAR(a - b, static_cast<double>(Fixed32(a) - Fixed32(b)), 2 * lsb);
+    EXPECT_NEAR(a * b, static_cast<double>(Fixed32(a) * Fixed32(b)), 1e-7);
+    EXPECT_NEAR(a / b, static_cast<double>(Fixed32(a) / Fixed32(b)), 1e-8);
+    EXPECT_EQ(Fixed32(3), Fixed32(3.0));
+    EXPECT_TRUE(Fixed32(-1.0) < Fixed32(0.5));
+}
+
+TEST(FixedPointTest, IntegerSqrtIsWithinOneLsb) {
+    // 정수 제곱근은 버림 결과이므로 양자화된 입력의 제곱근과 1 LSB 이내이다
+    const double lsb = Fixed32::resolution();
+    for (double value : {0.0, 1e-6, 0.5, 2.0, 2500.0, 1.234e6, 2.0e9}) {
+        Fixed32 fixed(value);
+        double root = static_cast<double>(sqrt(fixed));
+        EXPECT_NEAR(std::sqrt(static_cast<double>(fixed)), root, lsb)
+            << "sqrt(" << value << ")";
+    }
+    EXPECT_EQ(Fixed32(0), sqrt(Fixed32(-4.0)));
+    EXPECT_EQ(Fixed32(12), sqrt(Fixed32(144)));
+}
+
+// Phase 12.2: 수치 형식별 길이 ↔ 회전량 커널
+TEST(RollWireMathTest, DoubleKernelMatchesCalculator) {
+    // double 커널은 RollWireCalculator와 같은 값을 낸다
+    RollWireCalculator calculator(1.0, 50.0);
+    for (double length : {0.0, 0.001, 1.0, 5.0, 100.0}) {
+        EXPECT_NEAR(calculator.calculateRotationFromLength(length),
+                    RollWireMath<double>::rotationFromLength(1.0, 50.0, length),
+                    1e-9);
+    }
+    for (double rotation : {0.0, 1.0, 360.0, 36000.0}) {
+        EXPECT_NEAR(calculator.calculateLengthFromRotation(rotation),
+                    RollWireMath<double>::lengthFromRotation(1.0, 50.0, rotation),
+                    1e-12);
+    }
+}
+
+TEST(RollWireMathTest, FixedAndFloatStayWithinErrorBounds) {
+    // 5m 롤 범위에서 오차 한계:
+    //   Fixed32 - 회전량 1e-4도, 길이 1e-6m
+    //   float   - 회전량 상대 1e-5, 길이 상대 1e-5
+    RollWireCalculator calculator(0.8, 45.0);
+    double maxFixedRotationError = 0.0;
+    double maxFixedLengthError = 0.0;
+    for (int i = 0; i <= 500; ++i) {
+        double length = 0.01 * i;
+        double expected = calculator.calculateRotationFromLength(length);
+
+        double fixedRotation = static_cast<double>(
+            RollWireMath<Fixed32>::rotationFromLength(
+                Fixed32(0.8), Fixed32(45.0), Fixed32(length)));
+        double floatRotation = RollWireMath<float>::rotationFromLength(
+            0.8f, 45.0f, static_cast<float>(length));
+        maxFixedRotationError = std::max(maxFixedRotationError,
+                                         std::abs(fixedRotation - expected));
+        EXPECT_NEAR(expected, floatRotation, 1e-5 * expected + 1e-6);
+
+        double fixedLength = static_cast<double>(
+            RollWireMath<Fixed32>::lengthFromRotation(
+                Fixed32(0.8), Fixed32(45.0), Fixed32(expected)));
+        double floatLength = RollWireMath<float>::lengthFromRotation(
+            0.8f, 45.0f, static_cast<float>(expected));
+        maxFixedLengthError = std::max(maxFixedLengthError,
+                                       std::abs(fixedLength - length));
+        EXPECT_NEAR(length, floatLength, 1e-5 * length + 1e-7);
+    }
+    EXPECT_LT(maxFixedRotationError, 1e-4);
+    EXPECT_LT(maxFixedLengthError, 1e-6);
+}
+
+TEST(RollWireMathTest, LongDoubleIsAtLeastAsAccurateAsDouble) {
+    // long double 커널의 왕복 오차는 double 커널보다 크지 않다
+    double doubleError = 0.0;
+    double longDoubleError = 0.0;
+    for (int i = 1; i <= 100; ++i) {
+        double length = 0.05 * i;
+        double d = RollWireMath<double>::lengthFromRotation(
+            1.0, 50.0,
+            RollWireMath<double>::rotationFromLength(1.0, 50.0, length));
+        long double ld = RollWireMath<long double>::lengthFromRotation(
+            1.0L, 50.0L,
+            RollWireMath<long double>::rotationFromLength(1.0L, 50.0L, length));
+        doubleError = std::max(doubleError, std::abs(d - length));
+        longDoubleError = std::max(
+            longDoubleError, static_cast<double>(std::abs(ld - length)));
+    }
+    EXPECT_LE(longDoubleError, doubleError + 1e-18);
+}
+
+TEST(RollWireMathTest, FixedKernelIsBitReproducible) {
+    // 고정소수점 결과는 정수 연산만 사용하므로 원시 값이 고정된다
+    Fixed32 rotation = RollWireMath<Fixed32>::rotationFromLength(
+        Fixed32(1.0), Fixed32(50.0), Fixed32(2.5));
+    Fixed32 again = RollWireMath<Fixed32>::rotationFromLength(
+        Fixed32(1.0), Fixed32(50.0), Fixed32(2.5));
+    EXPECT_EQ(rotation.getRaw(), again.getRaw());
+
+    // 원시 값을 다시 넣은 왕복 결과도 입력 근처로 돌아온다
+    Fixed32 length = RollWireMath<Fixed32>::lengthFromRotation(
+        Fixed32(1.0), Fixed32(50.0), Fixed32::fromRaw(rotation.getRaw()));
+    EXPECT_NEAR(2.5, static_cast<double>(length), 1e-6);
+}
+
+TEST(RollWireMathTest, BatchConversionMatchesScalar) {
+    // 일괄 변환은 단일 변환과 같은 값을 낸다
+    Fixed32 lengths[4] = {Fixed32(0.0), Fixed32(0.5), Fixed32(1.5),
+                          Fixed32(4.0)};
+    Fixed32 rotations[4];
+    RollWireMath<Fixed32>::rotationsFromLengths(Fixed32(1.0), Fixed32(50.0),
+                                                lengths, rotations, 4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(RollWireMath<Fixed32>::rotationFromLength(
+                      Fixed32(1.0), Fixed32(50.0), lengths[i]),
+                  rotations[i]);
+    }
+}
+
+// Phase 12.3: 계산기와 커널의 단일 구현
+template <typename Scalar>
+void expectCalculatorMatchesKernel(double thickness, double radius) {
+    BasicRollWireCalculator<Scalar> calculator{Scalar(thickness),
+                                               Scalar(radius)};
+    Scalar lengths[5] = {Scalar(0.0), Scalar(0.001), Scalar(0.5), Scalar(1.5),
+                         Scalar(4.0)};
+    Scalar rotations[5];
+    Scalar roundTrip[5];
+    calculator.calculateRotationsFromLengths(lengths, rotations, 5);
+    calculator.calculateLengthsFromRotations(rotations, roundTrip, 5);
+    for (int i = 0; i < 5; ++i) {
+        Scalar rotation = RollWireMath<Scalar>::rotationFromLength(
+            Scalar(thickness), Scalar(radius), lengths[i]);
+        EXPECT_TRUE(rotation == calculator.calculateRotationFromLength(lengths[i]))
+            << "length " << static_cast<double>(lengths[i]);
+        EXPECT_TRUE(rotation == rotations[i]);
+        EXPECT_TRUE(RollWireMath<Scalar>::lengthFromRotation(
+                        Scalar(thickness), Scalar(radius), rotation) ==
+                    roundTrip[i]);
+    }
+}
+
+TEST(RollWireMathTest, CalculatorMatchesKernelForEveryScalar) {
+    // 모든 스칼라 형식에서 계산기는 커널과 같은 값을 낸다 (식은 한 곳)
+    expectCalculatorMatchesKernel<float>(0.8, 45.0);
+    expectCalculatorMatchesKernel<double>(0.8, 45.0);
+    expectCalculatorMatchesKernel<long double>(0.8, 45.0);
+    expectCalculatorMatchesKernel<Fixed32>(0.8, 45.0);
+}
+
+TEST(RollWireMathTest, FixedCalculatorValidatesInput) {
+    // 고정소수점 계산기도 0 이하 형상과 음수 입력을 거부한다
+    EXPECT_THROW(BasicRollWireCalculator<Fixed32>(Fixed32(0), Fixed32(50)),
+                 std::invalid_argument);
+    BasicRollWireCalculator<Fixed32> calculator(Fixed32(1.0), Fixed32(50.0));
+    EXPECT_THROW(calculator.calculateRotationFromLength(Fixed32(-0.5)),
+                 std::invalid_argument);
+    EXPECT_NEAR(1.0, static_cast<double>(calculator.calculateLengthFromRotation(
+                         calculator.calculateRotationFromLength(Fixed32(1.0)))),
+                1e-6);
+}
@@ -2,6 +2,8 @@
 #include <stdexcept>
 #include <cmath>
 #include <chrono>
+#include <type_traits>
+#include <vector>
 #include "RollWireCalculator.h"
 
 // Phase 1.1: RollWireCalculator 클래스 생성
@@ -1373,3 +1375,137 @@ TEST(RollWireCalculatorTest, ThousandCalculationsCompleteWithin100ms) {
     EXPECT_LT(finalError, 1e-5)
         << "Result validation failed after 1000 iterations";
 }
+
+// Phase 10.1: 일괄 변환
+TEST(RollWireCalculatorTest, BatchLengthsMatchSingleConversion) {
+    // 일괄 변환 결과는 calculateLengthFromRotation()과 일치한다
+    RollWireCalculator calculator(0.8, 45.0);
+    std::vector<double> rotations;
+    for (int i = 0; i <= 100; ++i) {
+        rotations.push_back(i * 73.5);
+    }
+    std::vector<double> lengths(rotations.size());
+
+    calculator.calculateLengthsFromRotations(rotations.data(), lengths.data(),
+                                             rotations.size());
+
+    for (size_t i = 0; i < rotations.size(); ++i) {
+        EXPECT_NEAR(calculator.calculateLengthFromRotation(rotations[i]),
+                    lengths[i], 1e-12)
+            << "at index " << i;
+    }
+}
+
+TEST(RollWireCalculatorTest, BatchLengthsThrowsOnNegativeRotationWithoutWriting) {
+    // 음수 회전량이 있으면 예외를 던지고 출력 배열을 변경하지 않는다
+    RollWireCalculator calculator(1.0, 50.0);
+    std::vector<double> rotations = {0.0, 90.0, -1.0, 180.0};
+    std::vector<double> lengths(rotations.size(), -7.0);
+
+    EXPECT_THROW(calculator.calculateLengthsFromRotations(
+                     rotations.data(), lengths.data(), rotations.size()),
+                 std::invalid_argument);
+    for (double length : lengths) {
+        EXPECT_DOUBLE_EQ(-7.0, length);
+    }
+}
+
+TEST(RollWireCalculatorTest, BatchLengthsAcceptsEmptyInput) {
+    // 개수가 0이면 아무 것도 하지 않는다
+    RollWireCalculator calculator(1.0, 50.0);
+
+    EXPECT_NO_THROW(calculator.calculateLengthsFromRotations(nullptr, nullptr, 0));
+}
+
+// Phase 13.1: 스칼라 형식 템플릿
+TEST(RollWireCalculatorTest, DoubleAliasIsBasicCalculator) {
+    // RollWireCalculator는 BasicRollWireCalculator<double>의 별칭이다
+    EXPECT_TRUE((std::is_same<RollWireCalculator,
+                              BasicRollWireCalculator<double>>::value));
+    EXPECT_EQ(8u, BasicRollWireCalculator<float>::BATCH_LANES);
+    EXPECT_EQ(4u, RollWireCalculator::BATCH_LANES);
+}
+
+TEST(RollWireCalculatorTest, FloatAndLongDoubleMatchDoubleWithinPrecision) {
+    // float는 상대 1e-6, long double은 상대 1e-14 이내로 double과 일치한다
+    BasicRollWireCalculator<float> floatCalculator(0.8f, 45.0f);
+    RollWireCalculator doubleCalculator(0.8, 45.0);
+    BasicRollWireCalculator<long double> longCalculator(0.8L, 45.0L);
+
+    for (double length : {0.001, 0.1, 1.0, 5.0, 50.0}) {
+        double expected = static_cast<double>(
+            longCalculator.calculateRotationFromLength(length));
+        EXPECT_NEAR(expected,
+                    doubleCalculator.calculateRotationFromLength(length),
+                    1e-14 * expected);
+        EXPECT_NEAR(expected,
+                    floatCalculator.calculateRotationFromLength(
+                        static_cast<float>(length)),
+                    1e-6 * expected)
+            << "length " << length;
+    }
+}
+
+TEST(RollWireCalculatorTest, FloatShortLengthHasNoCancellationError) {
+    // 짧은 길이(1mm)에서도 float 회전량의 상대 오차가 작다
+    BasicRollWireCalculator<float> floatCalculator(1.0f, 50.0f);
+    RollWireCalculator doubleCalculator(1.0, 50.0);
+
+    double expected = doubleCalculator.calculateRotationFromLength(0.001);
+    double actual = floatCalculator.calculateRotationFromLength(0.001f);
+    EXPECT_NEAR(expected, actual, 1e-6 * expected);
+}
+
+// Phase 13.2: 블록 단위 일괄 변환
+TEST(RollWireCalculatorTest, FloatBatchHandlesBlocksAndTail) {
+    // 8개 블록과 나머지 원소 모두 단일 변환과 같은 값을 낸다
+    BasicRollWireCalculator<float> calculator(1.0f, 50.0f);
+    std::vector<float> rotations;
+    for (int i = 0; i < 21; ++i) {
+        rotations.push_back(i * 250.0f);
+    }
+    std::vector<float> lengths(rotations.size());
+    std::vector<float> roundTrip(rotations.size());
+
+    calculator.calculateLengthsFromRotations(rotations.data(), lengths.data(),
+                                             rotations.size());
+    calculator.calculateRotationsFromLengths(lengths.data(), roundTrip.data(),
+                                             lengths.size());
+
+    for (size_t i = 0; i < rotations.size(); ++i) {
+        EXPECT_FLOAT_EQ(calculator.calculateLengthFromRotation(rotations[i]),
+                        lengths[i])
+            << "at index " << i;
+        EXPECT_FLOAT_EQ(calculator.calculateRotationFromLength(lengths[i]),
+                        roundTrip[i])
+            << "at index " << i;
+        EXPECT_NEAR(rotations[i], roundTrip[i], 1e-5f * rotations[i] + 1e-6f);
+    }
+}
+
+TEST(RollWireCalculatorTest, BatchRotationsThrowsOnNegativeLengthWithoutWriting) {
+    // 음수 길이가 있으면 예외를 던지고 출력 배열을 변경하지 않는다
+    RollWireCalculator calculator(1.0, 50.0);
+    std::vector<double> lengths = {0.0, 1.0, 2.0, 3.0, 4.0, -0.5};
+    std::vector<double> rotations(lengths.size(), -7.0);
+
+    EXPECT_THROW(calculator.calculateRotationsFromLengths(
+                     lengths.data(), rotations.data(), lengths.size()),
+                 std::invalid_argument);
+    for (double rotation : rotations) {
+        EXPECT_DOUBLE_EQ(-7.0, rotation);
+    }
+}
+
+TEST(RollWireCalculatorTest, BatchThrowsOnNegativeInsideFullBlock) {
+    // 블록 안의 음수도 검증 단계에서 걸러진다
+    BasicRollWireCalculator<float> calculator(1.0f, 50.0f);
+    std::vector<float> rotations(16, 10.0f);
+    rotations[3] = -1.0f;
+    std::vector<float> lengths(rotations.size(), -7.0f);
+
+    EXPECT_THROW(calculator.calculateLengthsFromRotations(
+                     rotations.data(), lengths.data(), rotations.size()),
+                 std::invalid_argument);
+    EXPECT_FLOAT_EQ(-7.0f, lengths[0]);
+}
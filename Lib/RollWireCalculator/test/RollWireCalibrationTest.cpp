@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "RollWireCalculator.h"
+#include "RollWireCalibration.h"
+
+namespace {
+
+// 계산기 모델로 (길이, 회전량) 표본 생성
+void makeSamples(double thickness, double radius, std::size_t count,
+                 double maxRotation, std::vector<double>& lengths,
+                 std::vector<double>& rotations) {
+    RollWireCalculator calculator(thickness, radius);
+    rotations.resize(count);
+    lengths.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rotations[i] = maxRotation * (i + 1) / count;
+    }
+    calculator.calculateLengthsFromRotations(rotations.data(), lengths.data(),
+                                             count);
+}
+
+}  // namespace
+
+// Phase 11.1: 닫힌 형태 최소제곱 보정
+TEST(RollWireCalibrationTest, RecoversExactModelParameters) {
+    // 잡음 없는 표본에서 두께와 내경을 정확히 복원한다
+    std::vector<double> lengths, rotations;
+    makeSamples(0.85, 47.5, 1000, 36000.0, lengths, rotations);
+
+    RollWireCalibration::Result result = RollWireCalibration::fit(
+        lengths.data(), rotations.data(), lengths.size());
+
+    EXPECT_NEAR(0.85, result.wireThickness, 1e-9);
+    EXPECT_NEAR(47.5, result.innerRadius, 1e-9);
+    EXPECT_NEAR(0.0, result.rmsResidual, 1e-6);
+    EXPECT_EQ(1000u, result.sampleCount);
+}
+
+TEST(RollWireCalibrationTest, NoisySamplesEstimateWithinTolerance) {
+    // 길이 측정 잡음(σ = 1mm)이 있어도 두께/내경을 근사한다
+    std::vector<double> lengths, rotations;
+    makeSamples(1.2, 60.0, 200000, 72000.0, lengths, rotations);
+    std::mt19937 generator(7);
+    std::normal_distribution<double> noise(0.0, 0.001);
+    for (double& length : lengths) {
+        length = std::max(0.0, length + noise(generator));
+    }
+
+    RollWireCalibration::Result result = RollWireCalibration::fit(
+        lengths.data(), rotations.data(), lengths.size());
+
+    EXPECT_NEAR(1.2, result.wireThickness, 1e-4);
+    EXPECT_NEAR(60.0, result.innerRadius, 1e-3);
+    EXPECT_NEAR(0.001, result.rmsResidual, 1e-4);
+}
+
+TEST(RollWireCalibrationTest, ChunkedAndMergedAccumulationMatchesSinglePass) {
+    // 나누어 누적하거나 병합해도 한 번에 맞춘 결과와 같다
+    std::vector<double> lengths, rotations;
+    makeSamples(0.5, 30.0, 1001, 20000.0, lengths, rotations);
+
+    RollWireCalibration first;
+    RollWireCalibration second;
+    first.addSamples(lengths.data(), rotations.data(), 500);
+    for (std::size_t i = 500; i < lengths.size(); ++i) {
+        second.addSample(lengths[i], rotations[i]);
+    }
+    first.merge(second);
+
+    RollWireCalibration::Result merged = first.solve();
+    RollWireCalibration::Result single = RollWireCalibration::fit(
+        lengths.data(), rotations.data(), lengths.size());
+    EXPECT_EQ(1001u, first.getSampleCount());
+    EXPECT_NEAR(single.wireThickness, merged.wireThickness, 1e-10);
+    EXPECT_NEAR(single.innerRadius, merged.innerRadius, 1e-9);
+}
+
+TEST(RollWireCalibrationTest, FittedParametersReproduceLengths) {
+    // 추정값으로 만든 계산기는 원래 길이를 재현한다
+    std::vector<double> lengths, rotations;
+    makeSamples(0.7, 52.0, 64, 10000.0, lengths, rotations);
+
+    RollWireCalibration::Result result = RollWireCalibration::fit(
+        lengths.data(), rotations.data(), lengths.size());
+    RollWireCalculator calculator(result.wireThickness, result.innerRadius);
+
+    for (std::size_t i = 0; i < lengths.size(); ++i) {
+        EXPECT_NEAR(lengths[i],
+                    calculator.calculateLengthFromRotation(rotations[i]), 1e-9);
+    }
+}
+
+// Phase 11.2: 입력 검증
+TEST(RollWireCalibrationTest, InvalidSamplesThrowWithoutAccumulating) {
+    // 음수/비유한 값이 있으면 예외를 던지고 누적값을 변경하지 않는다
+    RollWireCalibration calibration;
+    std::vector<double> lengths = {0.1, -0.2, 0.3};
+    std::vector<double> rotations = {100.0, 200.0, 300.0};
+
+    EXPECT_THROW(calibration.addSamples(lengths.data(), rotations.data(), 3),
+                 std::invalid_argument);
+    EXPECT_THROW(calibration.addSample(0.1, NAN), std::invalid_argument);
+    EXPECT_EQ(0u, calibration.getSampleCount());
+}
+
+TEST(RollWireCalibrationTest, DegenerateDataThrows) {
+    // 서로 다른 회전량이 2개 미만이면 두 계수를 결정할 수 없다
+    RollWireCalibration calibration;
+    EXPECT_THROW(calibration.solve(), std::invalid_argument);
+
+    calibration.addSample(1.0, 1000.0);
+    calibration.addSample(1.0, 1000.0);
+    EXPECT_THROW(calibration.solve(), std::invalid_argument);
+
+    // 길이가 회전량에 따라 줄어드는 데이터는 양수 두께/내경으로 맞출 수 없다
+    calibration.reset();
+    calibration.addSample(2.0, 100.0);
+    calibration.addSample(1.0, 200.0);
+    EXPECT_THROW(calibration.solve(), std::invalid_argument);
+}
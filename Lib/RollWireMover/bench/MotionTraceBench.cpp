@@ -0,0 +1,73 @@
+#include "MotionTrace.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include <benchmark/benchmark.h>
+
+// 이동 실행 추적 비용
+// 인자: 0 = 추적 비활성, 1 = 활성
+
+// 이벤트 한 건 기록 비용 (비활성이면 플래그 읽기만)
+static void BM_TraceInstant(benchmark::State &state) {
+  if (state.range(0) != 0) {
+    MotionTrace::enable();
+  }
+  double value = 0.0;
+  for (auto _ : state) {
+    MotionTrace::instant("bench", "bench", value);
+    value += 1.0;
+  }
+  MotionTrace::disable();
+  MotionTrace::clear();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceInstant)->Arg(0)->Arg(1);
+
+// moveTo 왕복 지연 (계획/전달 구간과 모터 시작/완료 이벤트 포함)
+static void BM_MoveTraced(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(1.0);
+  if (state.range(0) != 0) {
+    MotionTrace::enable();
+  }
+
+  bool forward = true;
+  for (auto _ : state) {
+    mover.moveTo(forward ? 1.0 : 0.5);
+    forward = !forward;
+  }
+  state.counters["events"] =
+      static_cast<double>(MotionTrace::collect().size());
+  MotionTrace::disable();
+  MotionTrace::clear();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MoveTraced)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// 단계 실행 궤적의 스텝 비용 (스텝마다 회전량 카운터 기록)
+static void BM_SteppedTraced(benchmark::State &state) {
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.setConstantVelocity(1.0);
+  if (state.range(0) != 0) {
+    MotionTrace::enable();
+  }
+
+  bool forward = true;
+  int64_t steps = 0;
+  for (auto _ : state) {
+    mover.moveTo(forward ? 1.0 : 0.5);
+    forward = !forward;
+    while (simMotor.stepN(1) > 0) {
+      steps++;
+    }
+  }
+  MotionTrace::disable();
+  MotionTrace::clear();
+  state.SetItemsProcessed(steps);
+}
+BENCHMARK(BM_SteppedTraced)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,31 @@
+#include "MotorDynamics.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// 동역학 모델 코어당 모터 수 벤치마크
+// 인자: 축 수, 1ms 제어 주기 (10 서브스텝)
+// realtime_motors: 한 코어가 실시간으로 시뮬레이션할 수 있는 모터 수
+static void BM_DynamicsBankAdvance(benchmark::State &state) {
+  size_t axes = state.range(0);
+  MotorDynamicsParams params;
+  params.wireInertiaPerTurn = 0.0005;
+  params.fullyWoundTurns = 200.0;
+  MotorDynamicsBank bank(params);
+  for (size_t i = 0; i < axes; ++i) {
+    bank.addAxis(0.0);
+  }
+
+  std::vector<double> setpoints(axes, 0.0);
+  for (auto _ : state) {
+    for (size_t i = 0; i < axes; ++i) {
+      setpoints[i] += 0.2 + 0.001 * i;
+    }
+    bank.advance(setpoints.data(), 0.001);
+  }
+  benchmark::DoNotOptimize(bank.getRotation(0));
+
+  state.SetItemsProcessed(state.iterations() * axes);
+  state.counters["realtime_motors"] = benchmark::Counter(
+      axes * 0.001, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_DynamicsBankAdvance)->Arg(1)->Arg(64)->Arg(256)->Arg(1024);
@@ -0,0 +1,85 @@
+#include "AsyncMover.h"
+#include "MoveScheduler.h"
+#include "SimMotorBank.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+// 코루틴 스케줄러 재개 비용 벤치마크
+// 인자: 동시 시퀀스 수
+
+namespace {
+
+// 매 주기 대기 후 재개 (스케줄러 자체 비용만 측정)
+MoveTask tickLoop(MoveScheduler &scheduler, const bool &running) {
+  while (running) {
+    co_await scheduler.delay(0.001);
+  }
+}
+
+MoveTask shuttle(AsyncMover &axis, const bool &running) {
+  double target = 0.05;
+  while (running) {
+    co_await axis.moveTo(target);
+    target = 0.05 - target;
+  }
+}
+
+} // namespace
+
+static void BM_SchedulerResume(benchmark::State &state) {
+  size_t tasks = static_cast<size_t>(state.range(0));
+  MoveScheduler scheduler(0.001, [] {});
+  bool running = true;
+  for (size_t i = 0; i < tasks; i++) {
+    scheduler.spawn(tickLoop(scheduler, running));
+  }
+
+  uint64_t startResumes = scheduler.getResumeCount();
+  for (auto _ : state) {
+    scheduler.step();
+  }
+  uint64_t resumes = scheduler.getResumeCount() - startResumes;
+  state.SetItemsProcessed(static_cast<int64_t>(resumes));
+  state.counters["ns_per_resume"] = benchmark::Counter(
+      static_cast<double>(resumes),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+
+  running = false;
+  scheduler.runUntilIdle();
+}
+BENCHMARK(BM_SchedulerResume)->Arg(1)->Arg(1000)->Arg(10000);
+
+// 뱅크 모터 + RollWireMover 이동 시퀀스 (5cm 왕복)
+static void BM_SchedulerShuttleAxes(benchmark::State &state) {
+  size_t axesCount = static_cast<size_t>(state.range(0));
+  SimMotorBank bank;
+  MoveScheduler scheduler(bank.getControlPeriod(), [&] { bank.stepAll(); });
+  std::vector<std::unique_ptr<RollWireMover>> movers;
+  std::vector<std::unique_ptr<AsyncMover>> axes;
+  bool running = true;
+  for (size_t i = 0; i < axesCount; i++) {
+    size_t index = bank.addMotor();
+    RollWireMover::ErrorCode error;
+    movers.push_back(std::make_unique<RollWireMover>(
+        1.0, 50.0, &bank.motor(index), error));
+    axes.push_back(std::make_unique<AsyncMover>(*movers.back(),
+                                                bank.motor(index), scheduler));
+    scheduler.spawn(shuttle(*axes.back(), running));
+  }
+
+  uint64_t startResumes = scheduler.getResumeCount();
+  for (auto _ : state) {
+    scheduler.step();
+  }
+  state.counters["resumes_per_tick"] =
+      static_cast<double>(scheduler.getResumeCount() - startResumes) /
+      state.iterations();
+  state.counters["ticks_per_s"] =
+      benchmark::Counter(static_cast<double>(state.iterations()),
+                         benchmark::Counter::kIsRate);
+
+  running = false;
+  scheduler.runUntilIdle();
+}
+BENCHMARK(BM_SchedulerShuttleAxes)->Arg(100)->Arg(1000);
@@ -0,0 +1,53 @@
+#include "OnlineCalibrator.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include "SpoolGeometry.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+// 온라인 보정 비용 벤치마크
+
+// 표본 하나 반영 (RLS 갱신 + 형상 변환 + SeqLock 게시)
+static void BM_OnlineCalibratorUpdate(benchmark::State &state) {
+  SpoolGeometry actual(1.05, 47.0, 5.0);
+  std::vector<double> rotations;
+  for (int i = 1; i <= 1000; i++) {
+    rotations.push_back(actual.rotationAtPosition(0.005 * i));
+  }
+  OnlineCalibrator calibrator(1.0, 50.0, 5.0, 0.999);
+
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        calibrator.addSample(0.005 * (i + 1), rotations[i]));
+    i = (i + 1) % rotations.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_OnlineCalibratorUpdate);
+
+// 10mm 이동 + 측정 위치 반영 (매 이동 형상 교체) vs 보정 없음
+// 인자: 0 = 보정 없음, 1 = 매 이동 보정
+static void BM_MoveWithOnlineCalibration(benchmark::State &state) {
+  SpoolGeometry actual(1.05, 47.0, 5.0);
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  bool calibrate = state.range(0) != 0;
+  if (calibrate) {
+    mover.setOnlineCalibrator(
+        std::make_shared<OnlineCalibrator>(1.0, 50.0, 5.0, 0.999));
+  }
+
+  double target = 1.0;
+  for (auto _ : state) {
+    mover.moveTo(target);
+    if (calibrate) {
+      mover.recordMeasuredPosition(
+          actual.positionAtRotation(simMotor.getCurrentRotation()));
+    }
+    target = 2.01 - target;
+  }
+}
+BENCHMARK(BM_MoveWithOnlineCalibration)->Arg(0)->Arg(1);
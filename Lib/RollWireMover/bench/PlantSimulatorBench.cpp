@@ -0,0 +1,33 @@
+#include "PlantSimulator.h"
+#include <benchmark/benchmark.h>
+
+// 플랜트 시뮬레이터 이벤트 처리량 벤치마크
+// 인자: 축 수, 시뮬레이션 시간(시간), 스레드 수 (평균 이벤트 간격 60초)
+static void BM_PlantShift(benchmark::State &state) {
+  PlantSimulator::Config config;
+  config.axisCount = state.range(0);
+  config.threadCount = state.range(2);
+  PlantSimulator::ErrorCode error;
+  PlantSimulator simulator(config, error);
+  simulator.scheduleShift(state.range(1) * 3600.0, 60.0, 2024);
+
+  size_t events = 0;
+  double simulatedHours = 0.0;
+  for (auto _ : state) {
+    PlantReport report = simulator.run();
+    events += report.totalEvents;
+    simulatedHours += report.cycleTime / 3600.0 * config.axisCount;
+    benchmark::DoNotOptimize(report.movesPerSecond);
+  }
+
+  state.counters["events_per_sec"] =
+      benchmark::Counter(events, benchmark::Counter::kIsRate);
+  state.counters["axis_hours_per_sec"] =
+      benchmark::Counter(simulatedHours, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_PlantShift)
+    ->Args({16, 100, 1})
+    ->Args({16, 100, 4})
+    ->Args({64, 250, 0})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
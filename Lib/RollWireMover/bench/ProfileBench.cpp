@@ -0,0 +1,451 @@
+#include "AllocationTracker.h"
+#include "FixedPoint.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include "TrajectoryKernel.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// 이동당 할당 집계를 벤치마크 카운터로 내보냄 (--benchmark_format=json 포함)
+static void exportAllocationCounters(benchmark::State &state,
+                                     const RollWireMover &mover) {
+  RollWireMover::AllocationStats stats = mover.getAllocationStats();
+  if (!stats.tracking || stats.moves == 0) {
+    return;
+  }
+  double moves = static_cast<double>(stats.moves);
+  state.counters["allocsPerMove"] = stats.totalAllocations / moves;
+  state.counters["bytesPerMove"] = stats.totalBytes / moves;
+  state.counters["peakBytes"] = static_cast<double>(stats.maxPeakBytes);
+}
+
+// 프로파일 생성 비용 벤치마크
+// 인자: 이동 거리 (mm)
+
+static void runMoveBenchmark(benchmark::State &state,
+                             RollWireMover::QuantizationMode mode) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setQuantizationMode(mode);
+  mover.setAccelerationTime(0.2);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.2);
+
+  double distance = state.range(0) / 1000.0;
+  double sign = 1.0;
+  for (auto _ : state) {
+    mover.moveRelative(sign * distance);
+    sign = -sign;
+  }
+  state.counters["samples"] =
+      static_cast<double>(mover.getLastVelocityProfile().size());
+  exportAllocationCounters(state, mover);
+}
+
+static void BM_MoveRounded(benchmark::State &state) {
+  runMoveBenchmark(state, RollWireMover::QuantizationMode::ROUNDED);
+}
+BENCHMARK(BM_MoveRounded)->Arg(10)->Arg(500)->Arg(4000);
+
+static void BM_MoveExactDistance(benchmark::State &state) {
+  runMoveBenchmark(state, RollWireMover::QuantizationMode::EXACT_DISTANCE);
+}
+BENCHMARK(BM_MoveExactDistance)->Arg(10)->Arg(500)->Arg(4000);
+
+// 제어 주기별 이동 비용 벤치마크
+// 인자: 제어 주기 (us), 1m 이동
+static void BM_MoveByControlPeriod(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setControlPeriod(state.range(0) / 1e6);
+  mover.setAccelerationTime(0.2);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.2);
+
+  double sign = 1.0;
+  for (auto _ : state) {
+    mover.moveRelative(sign * 1.0);
+    sign = -sign;
+  }
+  double samples = static_cast<double>(mover.getLastVelocityProfile().size());
+  state.counters["samples"] = samples;
+  // 속도 + 회전량 배열 (각 double)
+  state.counters["profile_bytes"] = samples * 2 * sizeof(double);
+}
+BENCHMARK(BM_MoveByControlPeriod)->Arg(250)->Arg(1000)->Arg(4000);
+
+// 배열 전달 vs 매개변수 궤적 전달 벤치마크
+// 인자: 이동 거리 (mm)
+static void runTrajectoryModeBenchmark(benchmark::State &state,
+                                       RollWireMover::TrajectoryMode mode) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(mode);
+  mover.setAccelerationTime(0.2);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.2);
+
+  double distance = state.range(0) / 1000.0;
+  double sign = 1.0;
+  for (auto _ : state) {
+    mover.moveRelative(sign * distance);
+    sign = -sign;
+  }
+  // 모터에 전달된 계획 데이터 크기
+  double bytes = mode == RollWireMover::TrajectoryMode::PARAMETRIC
+                     ? sizeof(MotionTrajectory)
+                     : simMotor.getLastProfile().size() * sizeof(double);
+  state.counters["plan_bytes"] = bytes;
+}
+
+static void BM_MoveSampledArray(benchmark::State &state) {
+  runTrajectoryModeBenchmark(state, RollWireMover::TrajectoryMode::SAMPLED);
+}
+BENCHMARK(BM_MoveSampledArray)->Arg(100)->Arg(4000);
+
+static void BM_MoveParametricTrajectory(benchmark::State &state) {
+  runTrajectoryModeBenchmark(state, RollWireMover::TrajectoryMode::PARAMETRIC);
+}
+BENCHMARK(BM_MoveParametricTrajectory)->Arg(100)->Arg(4000);
+
+// 고정 사다리꼴 vs 최단 시간 프로파일 벤치마크
+// 인자: 이동 거리 (mm), 0m(완전히 감김)에서 시작
+// move_time_s: 계획된 이동 시간 (초)
+static void runProfileTypeBenchmark(benchmark::State &state,
+                                    RollWireMover::ProfileType type) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setMotorLimits(150.0, 720.0);
+
+  // 사다리꼴: 최소 반지름(50mm)에서도 모터 한계를 지키는 고정값
+  const double PI = 3.14159265358979323846;
+  double velocity = 150.0 / 60.0 * 2.0 * PI * 0.05;
+  double acceleration = 720.0 * PI / 180.0 * 0.05;
+  mover.setConstantVelocity(velocity);
+  mover.setAccelerationTime(velocity / acceleration);
+  mover.setDecelerationTime(velocity / acceleration);
+  mover.setVelocityProfile(type);
+
+  double distance = state.range(0) / 1000.0;
+  double sign = 1.0;
+  for (auto _ : state) {
+    mover.moveRelative(sign * distance);
+    sign = -sign;
+  }
+  state.counters["move_time_s"] =
+      mover.getLastVelocityProfile().size() * mover.getControlPeriod();
+}
+
+static void BM_PlanFixedTrapezoid(benchmark::State &state) {
+  runProfileTypeBenchmark(state, RollWireMover::ProfileType::TRAPEZOID);
+}
+BENCHMARK(BM_PlanFixedTrapezoid)->Arg(500)->Arg(4000);
+
+static void BM_PlanMinimumTime(benchmark::State &state) {
+  runProfileTypeBenchmark(state, RollWireMover::ProfileType::MINIMUM_TIME);
+}
+BENCHMARK(BM_PlanMinimumTime)->Arg(500)->Arg(4000);
+
+// 와이어 공간 vs 회전 공간 계획 처리량 벤치마크
+// 인자: 이동 거리 (mm)
+static void runPlanningSpaceBenchmark(benchmark::State &state,
+                                      RollWireMover::PlanningSpace space) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setPlanningSpace(space);
+  mover.setConstantVelocity(0.3);
+  mover.setConstantRpm(50.0);
+
+  double distance = state.range(0) / 1000.0;
+  double sign = 1.0;
+  size_t samples = 0;
+  for (auto _ : state) {
+    mover.moveRelative(sign * distance);
+    samples += simMotor.getLastProfile().size();
+    sign = -sign;
+  }
+  state.SetItemsProcessed(samples);
+}
+
+static void BM_PlanWireSpace(benchmark::State &state) {
+  runPlanningSpaceBenchmark(state, RollWireMover::PlanningSpace::WIRE);
+}
+BENCHMARK(BM_PlanWireSpace)->Arg(500)->Arg(4000);
+
+static void BM_PlanRotationSpace(benchmark::State &state) {
+  runPlanningSpaceBenchmark(state, RollWireMover::PlanningSpace::ROTATION);
+}
+BENCHMARK(BM_PlanRotationSpace)->Arg(500)->Arg(4000);
+
+// 100구간 레시피: 개별 moveTo vs 이동 큐(경유점 속도 연결)
+// cycle_time_s: 레시피 전체 실행 시간 (초)
+struct RecipeStep {
+  bool isDwell;
+  double value; // 목표 위치 (m) 또는 대기 시간 (초)
+};
+
+static std::vector<RecipeStep> makeRecipe() {
+  // 0.3m씩 4번 내리고, 0.4m씩 3번 올린 뒤 대기 (반복)
+  std::vector<RecipeStep> recipe;
+  double position = 0.0;
+  size_t moves = 0;
+  while (moves < 100) {
+    for (int i = 0; i < 4 && moves < 100; ++i, ++moves) {
+      position = std::min(5.0, position + 0.3);
+      recipe.push_back({false, position});
+    }
+    for (int i = 0; i < 3 && moves < 100; ++i, ++moves) {
+      position = std::max(0.0, position - 0.4);
+      recipe.push_back({false, position});
+    }
+    recipe.push_back({true, 0.2});
+  }
+  return recipe;
+}
+
+static void BM_RecipeSequentialMoves(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(0.5);
+  std::vector<RecipeStep> recipe = makeRecipe();
+
+  double cycleTime = 0.0;
+  for (auto _ : state) {
+    mover.moveTo(0.0);
+    cycleTime = 0.0;
+    for (const RecipeStep &step : recipe) {
+      if (step.isDwell) {
+        cycleTime += step.value;
+      } else {
+        mover.moveTo(step.value);
+        cycleTime +=
+            mover.getLastVelocityProfile().size() * mover.getControlPeriod();
+      }
+    }
+  }
+  state.counters["cycle_time_s"] = cycleTime;
+}
+BENCHMARK(BM_RecipeSequentialMoves)->Unit(benchmark::kMillisecond);
+
+static void BM_RecipeBlendedQueue(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(0.5);
+  std::vector<RecipeStep> recipe = makeRecipe();
+
+  for (auto _ : state) {
+    mover.moveTo(0.0);
+    for (const RecipeStep &step : recipe) {
+      if (step.isDwell) {
+        mover.queueDwell(step.value);
+      } else {
+        mover.queueMove(step.value);
+      }
+    }
+    mover.executeQueue();
+  }
+  state.counters["cycle_time_s"] =
+      simMotor.getLastProfile().size() * mover.getControlPeriod();
+}
+BENCHMARK(BM_RecipeBlendedQueue)->Unit(benchmark::kMillisecond);
+
+// 이동 전환 지연 벤치마크 (최단 시간 프로파일, 4m 왕복)
+// 이동 경계에서 호출 측이 막히는 시간만 측정: 동기 moveTo는 계획 전체,
+// 비동기 계획은 버퍼 교체와 모터 전달. 현재 이동의 실행 시간(5ms 대기)
+// 동안 다음 이동을 백그라운드에서 계획한다.
+static void setupSwitchMover(RollWireMover &mover) {
+  mover.setVelocityProfile(RollWireMover::ProfileType::MINIMUM_TIME);
+  mover.setMotorLimits(300.0, 1440.0);
+}
+
+static void BM_MoveSwitchSynchronous(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  setupSwitchMover(mover);
+
+  double target = 4.0;
+  for (auto _ : state) {
+    auto begin = std::chrono::steady_clock::now();
+    mover.moveTo(target);
+    state.SetIterationTime(std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - begin)
+                               .count());
+    target = 4.0 - target;
+  }
+}
+BENCHMARK(BM_MoveSwitchSynchronous)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_MoveSwitchPlanned(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  setupSwitchMover(mover);
+
+  double target = 4.0;
+  mover.planMove(target).wait();
+  for (auto _ : state) {
+    auto begin = std::chrono::steady_clock::now();
+    mover.executePlannedMove();
+    state.SetIterationTime(std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - begin)
+                               .count());
+    target = 4.0 - target;
+    mover.planMove(target);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5)); // 이동 실행 중
+  }
+
+  RollWireMover::PlanningStats stats = mover.getPlanningStats();
+  state.counters["ready_rate"] = stats.readyRate();
+  state.counters["plan_us"] =
+      stats.plansRequested == 0
+          ? 0.0
+          : stats.totalPlanTime / stats.plansRequested * 1e6;
+}
+BENCHMARK(BM_MoveSwitchPlanned)
+    ->UseManualTime()
+    ->Iterations(200)
+    ->Unit(benchmark::kMicrosecond);
+
+// 짧은 이동 비용: 미리 계산한 설정 vs 매 이동마다 검증/파생 상수 계산
+// 인자: 이동 거리 (mm), 정속 구간이 없는 짧은 이동에서 설정 비용 비중이 큼
+static void BM_MoveToPrecomputedConfig(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  std::shared_ptr<const RollWireMover::MotionConfig> config =
+      mover.getMotionConfig();
+  double distance = state.range(0) / 1000.0;
+
+  double target = distance;
+  for (auto _ : state) {
+    mover.moveTo(target, *config);
+    target = distance - target;
+  }
+}
+BENCHMARK(BM_MoveToPrecomputedConfig)->Arg(10);
+
+static void BM_MoveToDerivedOnTheFly(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  RollWireMover::MotionSettings settings =
+      mover.getMotionConfig()->getSettings();
+  double distance = state.range(0) / 1000.0;
+
+  double target = distance;
+  for (auto _ : state) {
+    std::shared_ptr<const RollWireMover::MotionConfig> config =
+        mover.makeMotionConfig(settings, error);
+    mover.moveTo(target, *config);
+    target = distance - target;
+  }
+}
+BENCHMARK(BM_MoveToDerivedOnTheFly)->Arg(10);
+
+// 스풀 교체 후 첫 이동까지의 시간 (내경 변경 + 10mm 이동)
+// 비교 기준: 새 내경으로 이동기를 다시 생성
+static void BM_SpoolSwapToFirstMove(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  double radius = 80.0;
+  double target = 0.01;
+  for (auto _ : state) {
+    mover.setInnerRadius(radius);
+    mover.moveTo(target);
+    radius = 130.0 - radius;
+    target = 0.01 - target;
+  }
+}
+BENCHMARK(BM_SpoolSwapToFirstMove);
+
+// 내경 변경 자체의 비용 (스풀 변환은 다음 이동까지 생성되지 않음)
+static void BM_SetInnerRadius(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  double radius = 80.0;
+  for (auto _ : state) {
+    mover.setInnerRadius(radius);
+    radius = 130.0 - radius;
+  }
+}
+BENCHMARK(BM_SetInnerRadius);
+
+static void BM_SpoolSwapRebuildMover(benchmark::State &state) {
+  SimMotor simMotor;
+  double radius = 80.0;
+  for (auto _ : state) {
+    RollWireMover::ErrorCode error;
+    RollWireMover mover(1.0, radius, &simMotor, error);
+    mover.moveTo(0.01);
+    radius = 130.0 - radius;
+  }
+}
+BENCHMARK(BM_SpoolSwapRebuildMover);
+
+// 수치 형식별 궤적 평가 처리량 (드라이브 측 회전량 샘플 생성)
+// 인자: 이동 거리 (mm)
+template <typename Scalar>
+static void BM_TrajectoryKernel(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.moveRelative(state.range(0) / 1000.0);
+  MotionTrajectory trajectory = mover.getLastTrajectory();
+  std::vector<Scalar> rotations(trajectory.sampleCount());
+
+  for (auto _ : state) {
+    sampleTrajectoryRotations(trajectory, rotations.data(), rotations.size());
+    benchmark::DoNotOptimize(rotations.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * rotations.size());
+}
+BENCHMARK_TEMPLATE(BM_TrajectoryKernel, float)->Arg(500);
+BENCHMARK_TEMPLATE(BM_TrajectoryKernel, double)->Arg(500);
+BENCHMARK_TEMPLATE(BM_TrajectoryKernel, Fixed32)->Arg(500);
+
+// 속도 프로파일 기록 모드별 이동 비용 (느린 장거리 이동)
+// retainedKB: 이동이 끝난 뒤에도 이동기가 보관하는 힙 (기록된 프로파일)
+// 인자: 기록 모드 (0 = OFF, 1 = LAST, 2 = HISTORY 16개)
+static void BM_MoveProfileCapture(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(0.1);
+  mover.setProfileCapture(
+      static_cast<RollWireMover::ProfileCaptureMode>(state.range(0)));
+  mover.moveTo(0.5);
+  int64_t liveBefore = AllocationTracker::read().liveBytes -
+                       static_cast<int64_t>(
+                           mover.getLastVelocityProfile().capacity() *
+                           sizeof(double));
+
+  double target = 4.0;
+  for (auto _ : state) {
+    mover.moveTo(target);
+    target = 4.5 - target;
+  }
+  exportAllocationCounters(state, mover);
+  state.counters["retainedKB"] =
+      (AllocationTracker::read().liveBytes - liveBefore) / 1024.0;
+}
+BENCHMARK(BM_MoveProfileCapture)->Arg(0)->Arg(1)->Arg(2);
@@ -0,0 +1,291 @@
+#include "AllocationTracker.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+// 교대 작업 시나리오 벤치마크
+//
+// 실제 작업에 가까운 명령 흐름(짧은 조그, 느린 장거리 내림, 잦은 롤 교체)을
+// RollWireMover + SimMotor로 재생하며 다음을 보고합니다.
+//   p50/p99/p999   : moveTo 지연 (us)
+//   allocsPerMove  : moveTo 한 번의 힙 할당 횟수 (RollWireMover::AllocationStats)
+//   bytesPerMove   : moveTo 한 번의 힙 할당 바이트
+//   movePeakKB     : moveTo 중 힙 사용량 증가 최고점
+//   heapHighWaterKB: 프로세스 힙 사용량 최고점
+//   maxRssKB       : 프로세스 최대 상주 메모리
+// 할당 집계는 rollwiremover_alloc_hook 링크로 이루어집니다.
+//
+// 기록된 명령 파일은 --scenario=<경로>로 추가합니다. (여러 번 지정 가능)
+//   move <m>         : 절대 위치 이동
+//   radius <mm>      : 롤 내경 변경 (정지 상태)
+//   velocity <m/s>   : 정속 속도 변경
+//   # ...            : 주석
+
+// ---------------------------------------------------------------------------
+// 명령 흐름
+// ---------------------------------------------------------------------------
+namespace {
+
+struct ScenarioCommand {
+  enum Type { MOVE_TO, SET_INNER_RADIUS, SET_VELOCITY };
+  Type type;
+  double value;
+};
+
+typedef std::vector<ScenarioCommand> Scenario;
+
+const double NOMINAL_VELOCITY = 0.5; // 시나리오 시작 정속 속도 (m/s)
+
+// 짧은 조그: 작업 위치 근처에서 5~20mm 왕복
+Scenario shortJogs(size_t count) {
+  std::mt19937 random(1);
+  std::uniform_real_distribution<double> jog(0.005, 0.02);
+  Scenario scenario;
+  double position = 2.0;
+  for (size_t i = 0; i < count; i++) {
+    position += (i % 2 == 0 ? 1.0 : -1.0) * jog(random);
+    scenario.push_back({ScenarioCommand::MOVE_TO, position});
+  }
+  return scenario;
+}
+
+// 느린 장거리 내림: 0.1m/s로 0.5m ↔ 4.5m
+Scenario longSlowLowers(size_t count) {
+  Scenario scenario;
+  scenario.push_back({ScenarioCommand::SET_VELOCITY, 0.1});
+  for (size_t i = 0; i < count; i++) {
+    scenario.push_back({ScenarioCommand::MOVE_TO, i % 2 == 0 ? 4.5 : 0.5});
+  }
+  scenario.push_back({ScenarioCommand::SET_VELOCITY, NOMINAL_VELOCITY});
+  return scenario;
+}
+
+// 잦은 롤 교체: 이동 4번마다 내경 45~55mm 롤로 교체
+Scenario frequentRadiusChanges(size_t count) {
+  std::mt19937 random(2);
+  std::uniform_real_distribution<double> radius(45.0, 55.0);
+  std::uniform_real_distribution<double> target(0.2, 4.8);
+  Scenario scenario;
+  for (size_t i = 0; i < count; i++) {
+    if (i % 4 == 0) {
+      scenario.push_back({ScenarioCommand::SET_INNER_RADIUS, radius(random)});
+    }
+    scenario.push_back({ScenarioCommand::MOVE_TO, target(random)});
+  }
+  scenario.push_back({ScenarioCommand::SET_INNER_RADIUS, 50.0});
+  return scenario;
+}
+
+// 교대 혼합: 조그 80%, 중거리 이동 15%, 느린 장거리 내림 4%, 롤 교체 1%
+Scenario shiftMix(size_t count) {
+  std::mt19937 random(3);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  Scenario scenario;
+  double position = 2.0;
+  for (size_t i = 0; i < count; i++) {
+    double pick = unit(random);
+    if (pick < 0.01) {
+      scenario.push_back(
+          {ScenarioCommand::SET_INNER_RADIUS, 45.0 + 10.0 * unit(random)});
+      continue;
+    }
+    if (pick < 0.05) {
+      position = position < 2.5 ? 4.5 : 0.5;
+      scenario.push_back({ScenarioCommand::SET_VELOCITY, 0.1});
+      scenario.push_back({ScenarioCommand::MOVE_TO, position});
+      scenario.push_back({ScenarioCommand::SET_VELOCITY, NOMINAL_VELOCITY});
+      continue;
+    }
+    if (pick < 0.20) {
+      position = 0.5 + 4.0 * unit(random);
+    } else {
+      position += (unit(random) < 0.5 ? -1.0 : 1.0) *
+                  (0.005 + 0.015 * unit(random));
+      position = std::min(4.8, std::max(0.2, position));
+    }
+    scenario.push_back({ScenarioCommand::MOVE_TO, position});
+  }
+  scenario.push_back({ScenarioCommand::SET_INNER_RADIUS, 50.0});
+  return scenario;
+}
+
+// 기록된 명령 파일 로드 (알 수 없는 명령이 있으면 false)
+bool loadScenario(const std::string &path, Scenario &scenario,
+                  std::string &error) {
+  std::ifstream in(path);
+  if (!in) {
+    error = "cannot open " + path;
+    return false;
+  }
+  std::string line;
+  size_t lineNumber = 0;
+  while (std::getline(in, line)) {
+    lineNumber++;
+    std::istringstream fields(line);
+    std::string command;
+    double value;
+    if (!(fields >> command) || command[0] == '#') {
+      continue;
+    }
+    if (!(fields >> value)) {
+      error = path + ":" + std::to_string(lineNumber) + ": missing value";
+      return false;
+    }
+    if (command == "move") {
+      scenario.push_back({ScenarioCommand::MOVE_TO, value});
+    } else if (command == "radius") {
+      scenario.push_back({ScenarioCommand::SET_INNER_RADIUS, value});
+    } else if (command == "velocity") {
+      scenario.push_back({ScenarioCommand::SET_VELOCITY, value});
+    } else {
+      error = path + ":" + std::to_string(lineNumber) + ": unknown command '" +
+              command + "'";
+      return false;
+    }
+  }
+  return true;
+}
+
+double percentile(std::vector<double> &values, double fraction) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  size_t index = static_cast<size_t>(fraction * (values.size() - 1) + 0.5);
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+// 명령 흐름 재생 (반복마다 한 번 전체 재생)
+void replayScenario(benchmark::State &state, const Scenario &scenario) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(NOMINAL_VELOCITY);
+
+  size_t moveCount = 0;
+  for (const ScenarioCommand &command : scenario) {
+    moveCount += command.type == ScenarioCommand::MOVE_TO ? 1 : 0;
+  }
+  std::vector<double> latencies;
+  latencies.reserve(moveCount * 8);
+
+  uint64_t moves = 0;
+  uint64_t failures = 0;
+  mover.resetAllocationStats();
+
+  for (auto _ : state) {
+    for (const ScenarioCommand &command : scenario) {
+      switch (command.type) {
+      case ScenarioCommand::SET_INNER_RADIUS:
+        mover.setInnerRadius(command.value);
+        break;
+      case ScenarioCommand::SET_VELOCITY:
+        mover.setConstantVelocity(command.value);
+        break;
+      case ScenarioCommand::MOVE_TO: {
+        auto start = std::chrono::steady_clock::now();
+        RollWireMover::ErrorCode result = mover.moveTo(command.value);
+        auto end = std::chrono::steady_clock::now();
+        failures += result == RollWireMover::ErrorCode::SUCCESS ? 0 : 1;
+        moves++;
+        latencies.push_back(
+            std::chrono::duration<double, std::micro>(end - start).count());
+        break;
+      }
+      }
+    }
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  RollWireMover::AllocationStats stats = mover.getAllocationStats();
+  double moveDivisor =
+      stats.moves > 0 ? static_cast<double>(stats.moves) : 1.0;
+  state.counters["moves"] = static_cast<double>(moves);
+  state.counters["failures"] = static_cast<double>(failures);
+  state.counters["p50_us"] = percentile(latencies, 0.50);
+  state.counters["p99_us"] = percentile(latencies, 0.99);
+  state.counters["p999_us"] = percentile(latencies, 0.999);
+  state.counters["allocsPerMove"] = stats.totalAllocations / moveDivisor;
+  state.counters["bytesPerMove"] = stats.totalBytes / moveDivisor;
+  state.counters["movePeakKB"] = stats.maxPeakBytes / 1024.0;
+  state.counters["heapHighWaterKB"] =
+      AllocationTracker::read().peakLiveBytes / 1024.0;
+  state.counters["maxRssKB"] = static_cast<double>(usage.ru_maxrss);
+  state.SetItemsProcessed(static_cast<int64_t>(moves));
+}
+
+} // namespace
+
+static void BM_ScenarioShortJogs(benchmark::State &state) {
+  replayScenario(state, shortJogs(2000));
+}
+BENCHMARK(BM_ScenarioShortJogs)->Unit(benchmark::kMillisecond);
+
+static void BM_ScenarioLongSlowLowers(benchmark::State &state) {
+  replayScenario(state, longSlowLowers(20));
+}
+BENCHMARK(BM_ScenarioLongSlowLowers)->Unit(benchmark::kMillisecond);
+
+static void BM_ScenarioFrequentRadiusChanges(benchmark::State &state) {
+  replayScenario(state, frequentRadiusChanges(400));
+}
+BENCHMARK(BM_ScenarioFrequentRadiusChanges)->Unit(benchmark::kMillisecond);
+
+static void BM_ScenarioShiftMix(benchmark::State &state) {
+  replayScenario(state, shiftMix(2000));
+}
+BENCHMARK(BM_ScenarioShiftMix)->Unit(benchmark::kMillisecond);
+
+// --scenario=<경로> 인자를 기록된 시나리오로 등록한 뒤 나머지 인자는
+// Google Benchmark에 넘김
+int main(int argc, char **argv) {
+  static std::vector<Scenario> recorded;
+  std::vector<std::string> names;
+  std::vector<char *> remaining;
+  const char *prefix = "--scenario=";
+  for (int i = 0; i < argc; i++) {
+    if (std::strncmp(argv[i], prefix, std::strlen(prefix)) != 0) {
+      remaining.push_back(argv[i]);
+      continue;
+    }
+    std::string path = argv[i] + std::strlen(prefix);
+    Scenario scenario;
+    std::string error;
+    if (!loadScenario(path, scenario, error)) {
+      std::fprintf(stderr, "%s\n", error.c_str());
+      return 1;
+    }
+    recorded.push_back(scenario);
+    names.push_back("BM_ScenarioRecorded/" + path);
+  }
+  for (size_t i = 0; i < recorded.size(); i++) {
+    const Scenario *scenario = &recorded[i];
+    benchmark::RegisterBenchmark(
+        names[i].c_str(),
+        [scenario](benchmark::State &state) {
+          replayScenario(state, *scenario);
+        })
+        ->Unit(benchmark::kMillisecond);
+  }
+
+  int remainingCount = static_cast<int>(remaining.size());
+  benchmark::Initialize(&remainingCount, remaining.data());
+  if (benchmark::ReportUnrecognizedArguments(remainingCount, remaining.data())) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
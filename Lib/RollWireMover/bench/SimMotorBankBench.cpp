@@ -0,0 +1,76 @@
+#include "SimMotor.h"
+#include "SimMotorBank.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+// 개별 SimMotor N개 vs SimMotorBank 스텝 벤치마크
+// 인자: 모터 수 (모터당 1000 샘플 프로파일, 반복당 한 샘플 진행)
+
+static const size_t PROFILE_SAMPLES = 1000;
+
+static std::vector<double> makeMotorProfile(size_t motor) {
+  std::vector<double> profile(PROFILE_SAMPLES);
+  for (size_t i = 0; i < PROFILE_SAMPLES; ++i) {
+    profile[i] = (motor + 1) * i * 0.01;
+  }
+  return profile;
+}
+
+static void BM_IndividualSimMotors(benchmark::State &state) {
+  size_t count = state.range(0);
+  std::vector<std::unique_ptr<SimMotor>> motors;
+  std::vector<std::vector<double>> profiles;
+  for (size_t i = 0; i < count; ++i) {
+    motors.push_back(std::make_unique<SimMotor>());
+    profiles.push_back(makeMotorProfile(i));
+  }
+
+  size_t stepIndex = PROFILE_SAMPLES;
+  for (auto _ : state) {
+    // 프로파일이 끝나면 다시 적재 (측정 제외)
+    if (stepIndex == PROFILE_SAMPLES) {
+      state.PauseTiming();
+      for (size_t i = 0; i < count; ++i) {
+        motors[i]->loadProfile(profiles[i]);
+        motors[i]->startExecution();
+      }
+      stepIndex = 0;
+      state.ResumeTiming();
+    }
+    for (auto &motor : motors) {
+      motor->step();
+    }
+    ++stepIndex;
+  }
+  benchmark::DoNotOptimize(motors[0]->getCurrentRotation());
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_IndividualSimMotors)->Arg(16)->Arg(128)->Arg(1024);
+
+static void BM_SimMotorBank(benchmark::State &state) {
+  size_t count = state.range(0);
+  SimMotorBank bank;
+  std::vector<std::vector<double>> profiles;
+  for (size_t i = 0; i < count; ++i) {
+    bank.addMotor();
+    profiles.push_back(makeMotorProfile(i));
+  }
+
+  size_t stepIndex = PROFILE_SAMPLES;
+  for (auto _ : state) {
+    if (stepIndex == PROFILE_SAMPLES) {
+      state.PauseTiming();
+      for (size_t i = 0; i < count; ++i) {
+        bank.motor(i).executeRotationProfile(profiles[i]);
+      }
+      stepIndex = 0;
+      state.ResumeTiming();
+    }
+    bank.stepAll();
+    ++stepIndex;
+  }
+  benchmark::DoNotOptimize(bank.getCurrentRotation(0));
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SimMotorBank)->Arg(16)->Arg(128)->Arg(1024);
@@ -0,0 +1,100 @@
+#include "SimMotor.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// 프로파일 전달 방식별 벤치마크 (복사 / 이동 / 공유)
+// 인자: 샘플 수
+
+static std::vector<double> makeProfile(size_t samples) {
+  std::vector<double> profile(samples);
+  for (size_t i = 0; i < samples; ++i) {
+    profile[i] = i * 0.01;
+  }
+  return profile;
+}
+
+static void BM_HandoffCopy(benchmark::State &state) {
+  SimMotor simMotor;
+  std::vector<double> profile = makeProfile(state.range(0));
+  for (auto _ : state) {
+    simMotor.executeRotationProfile(profile);
+  }
+  state.SetBytesProcessed(state.iterations() * profile.size() *
+                          sizeof(double));
+}
+BENCHMARK(BM_HandoffCopy)->Arg(500000);
+
+static void BM_HandoffMove(benchmark::State &state) {
+  SimMotor simMotor;
+  std::vector<double> source = makeProfile(state.range(0));
+  for (auto _ : state) {
+    // 이동할 버퍼 준비 (측정 제외)
+    state.PauseTiming();
+    std::vector<double> profile = source;
+    state.ResumeTiming();
+
+    simMotor.executeRotationProfile(std::move(profile));
+  }
+}
+BENCHMARK(BM_HandoffMove)->Arg(500000);
+
+static void BM_HandoffShared(benchmark::State &state) {
+  SimMotor simMotor;
+  auto profile =
+      std::make_shared<const std::vector<double>>(makeProfile(state.range(0)));
+  for (auto _ : state) {
+    simMotor.executeRotationProfile(profile);
+  }
+}
+BENCHMARK(BM_HandoffShared)->Arg(500000);
+
+// 스텝 실행 방식별 벤치마크
+// 인자: 샘플 수 (1kHz 기준 1시간 = 3.6M 샘플)
+static void BM_StepSingle(benchmark::State &state) {
+  SimMotor simMotor;
+  auto profile = std::make_shared<const std::vector<double>>(
+      makeProfile(state.range(0)));
+  for (auto _ : state) {
+    simMotor.loadProfile(profile);
+    simMotor.startExecution();
+    while (simMotor.isRunning()) {
+      simMotor.step();
+    }
+    benchmark::DoNotOptimize(simMotor.getCurrentRotation());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StepSingle)->Arg(3600000);
+
+static void BM_StepBatched(benchmark::State &state) {
+  SimMotor simMotor;
+  auto profile = std::make_shared<const std::vector<double>>(
+      makeProfile(state.range(0)));
+  for (auto _ : state) {
+    simMotor.loadProfile(profile);
+    simMotor.startExecution();
+    simMotor.stepN(state.range(0));
+    benchmark::DoNotOptimize(simMotor.getCurrentRotation());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StepBatched)->Arg(3600000);
+
+static void BM_StepTimeWarp(benchmark::State &state) {
+  SimMotor simMotor;
+  simMotor.setTimeWarp(true);
+  // 1분(60,000 샘플)마다 상태 관찰
+  simMotor.setStepCallback([](const SimMotor &) {}, 60000);
+  auto profile = std::make_shared<const std::vector<double>>(
+      makeProfile(state.range(0)));
+  for (auto _ : state) {
+    simMotor.loadProfile(profile);
+    simMotor.startExecution();
+    simMotor.runUntil(simMotor.getElapsedTime() + 3600.0);
+    benchmark::DoNotOptimize(simMotor.getCurrentRotation());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StepTimeWarp)->Arg(3600000);
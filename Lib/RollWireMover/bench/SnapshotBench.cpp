@@ -0,0 +1,88 @@
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include "SpoolSnapshot.h"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <string>
+
+// 스냅샷 기록 지연 벤치마크 (매 이동마다 기록할 수 있는지 확인)
+// 인자: durable (0 = write+rename, 1 = write+fsync+rename)
+
+namespace {
+
+std::string benchPath() { return "rollwiremover_bench.snap"; }
+
+SpoolSnapshot benchSnapshot() {
+  SpoolSnapshot snapshot;
+  snapshot.position = 1.25;
+  snapshot.motorRotation = 812.5;
+  snapshot.wireThickness = 1.0;
+  snapshot.innerRadius = 50.0;
+  return snapshot;
+}
+
+} // namespace
+
+static void BM_SnapshotEncode(benchmark::State &state) {
+  SpoolSnapshot snapshot = benchSnapshot();
+  uint8_t buffer[SpoolSnapshotFile::ENCODED_SIZE];
+  for (auto _ : state) {
+    SpoolSnapshotFile::encode(snapshot, buffer);
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+BENCHMARK(BM_SnapshotEncode);
+
+static void BM_SnapshotWrite(benchmark::State &state) {
+  SpoolSnapshot snapshot = benchSnapshot();
+  bool durable = state.range(0) != 0;
+  for (auto _ : state) {
+    snapshot.moveCount++;
+    benchmark::DoNotOptimize(
+        SpoolSnapshotFile::write(benchPath(), snapshot, durable));
+  }
+  std::remove(benchPath().c_str());
+}
+BENCHMARK(BM_SnapshotWrite)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
+
+// 웜 스타트: 파일 읽기 + 검증 + 설정 재계산
+static void BM_SnapshotWarmRestore(benchmark::State &state) {
+  SpoolSnapshot snapshot = benchSnapshot();
+  SpoolSnapshotFile::write(benchPath(), snapshot, false);
+  SimMotor simMotor;
+  simMotor.restoreRotation(snapshot.motorRotation);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mover.restoreSnapshot(benchPath()));
+  }
+  std::remove(benchPath().c_str());
+}
+BENCHMARK(BM_SnapshotWarmRestore)->Unit(benchmark::kMicrosecond);
+
+// 10mm 이동 + 자동 스냅샷 (이동 비용 대비 기록 비용)
+static void BM_MoveWithSnapshot(benchmark::State &state) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  if (state.range(0) >= 0) {
+    mover.enableSnapshots(benchPath(), state.range(0) != 0);
+  }
+  double target = 0.01;
+  for (auto _ : state) {
+    mover.moveTo(target);
+    target = 0.01 - target;
+  }
+  RollWireMover::SnapshotStats stats = mover.getSnapshotStats();
+  state.counters["max_write_us"] = stats.maxWriteTime * 1e6;
+  std::remove(benchPath().c_str());
+}
+// 인자: -1 = 스냅샷 없음, 0 = fsync 없음, 1 = fsync
+BENCHMARK(BM_MoveWithSnapshot)
+    ->Arg(-1)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,98 @@
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// 명령 실행 중 상태/파라미터 조회 처리량 벤치마크
+// 백그라운드 명령 스레드가 이동과 설정 변경을 반복하는 동안 조회 스레드 수를
+// 늘려가며 측정한다. 비교 기준은 뮤텍스로 보호한 같은 크기의 상태 복사.
+
+namespace {
+
+std::unique_ptr<SimMotor> benchMotor;
+std::unique_ptr<RollWireMover> benchMover;
+std::thread commandThread;
+std::atomic<bool> commandRunning(false);
+
+std::mutex baselineMutex;
+RollWireMover::Status baselineStatus;
+
+void startCommands(const benchmark::State &) {
+  benchMotor.reset(new SimMotor());
+  RollWireMover::ErrorCode error;
+  benchMover.reset(new RollWireMover(1.0, 50.0, benchMotor.get(), error));
+  benchMover->setConstantVelocity(1.0);
+
+  commandRunning = true;
+  commandThread = std::thread([] {
+    int i = 0;
+    while (commandRunning.load()) {
+      benchMover->setControlPeriod(i % 2 == 0 ? 0.002 : 0.001);
+      benchMover->moveTo(i % 2 == 0 ? 0.5 : 1.0);
+      {
+        std::lock_guard<std::mutex> lock(baselineMutex);
+        baselineStatus = benchMover->getStatus();
+      }
+      i++;
+    }
+  });
+}
+
+void stopCommands(const benchmark::State &) {
+  commandRunning = false;
+  commandThread.join();
+  benchMover.reset();
+  benchMotor.reset();
+}
+
+} // namespace
+
+static void BM_StatusReadSeqLock(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(benchMover->getStatus());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StatusReadSeqLock)
+    ->Setup(startCommands)
+    ->Teardown(stopCommands)
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->UseRealTime();
+
+static void BM_ParameterReadAtomicBlock(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(benchMover->getControlPeriod());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParameterReadAtomicBlock)
+    ->Setup(startCommands)
+    ->Teardown(stopCommands)
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->UseRealTime();
+
+static void BM_StatusReadMutexBaseline(benchmark::State &state) {
+  for (auto _ : state) {
+    RollWireMover::Status status;
+    {
+      std::lock_guard<std::mutex> lock(baselineMutex);
+      status = baselineStatus;
+    }
+    benchmark::DoNotOptimize(status);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StatusReadMutexBaseline)
+    ->Setup(startCommands)
+    ->Teardown(stopCommands)
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->UseRealTime();
@@ -0,0 +1,43 @@
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief AllocationTracker - 프로세스 힙 할당 집계
+ *
+ * 집계는 할당 훅(AllocationHook.cpp, CMake 타깃 rollwiremover_alloc_hook)을
+ * 실행 파일에 링크했을 때만 이루어집니다. 훅은 전역 operator new/delete를
+ * 교체하여 모든 할당을 원자적 카운터에 반영하므로, 프로파일 벡터처럼 Motor
+ * 인터페이스를 건너는 std::vector<double>도 형식을 바꾸지 않고 집계됩니다.
+ * 훅을 링크하지 않으면 isInstalled()가 false이고 모든 값은 0이며 비용도
+ * 없습니다.
+ *
+ * 구간 최고점(window peak)은 beginWindow() 이후의 힙 사용량 최고점입니다.
+ * 여러 스레드가 동시에 구간을 시작하면 구간이 겹쳐 함께 집계됩니다.
+ */
+class AllocationTracker {
+public:
+  struct Counters {
+    uint64_t allocations = 0;   // 누적 할당 횟수
+    uint64_t deallocations = 0; // 누적 해제 횟수
+    uint64_t bytes = 0;         // 누적 요청 바이트
+    int64_t liveBytes = 0;      // 현재 사용 중인 바이트 (블록 크기 기준)
+    int64_t peakLiveBytes = 0;  // 프로세스 시작 이후 liveBytes 최고점
+  };
+
+  static bool isInstalled(); // 할당 훅이 링크되었는지
+  static Counters read();    // 잠금 없음
+
+  // 구간 최고점을 현재 사용량으로 초기화하고 현재 사용량 반환
+  static int64_t beginWindow();
+  static int64_t windowPeak(); // beginWindow() 이후 liveBytes 최고점
+
+  // 할당 훅에서 호출 (requested: 요청 크기, block: 실제 블록 크기)
+  static void recordAllocation(size_t requested, size_t block);
+  static void recordDeallocation(size_t block);
+  static void markInstalled();
+};
+
+#endif // ALLOCATIONTRACKER_H
@@ -0,0 +1,53 @@
+#ifndef ASYNCMOVER_H
+#define ASYNCMOVER_H
+
+// C++20 코루틴 계층 (선택 빌드: rollwiremover_coro 타깃)
+#include "MoveScheduler.h"
+#include "RollWireMover.h"
+
+/**
+ * @brief AsyncMover - RollWireMover의 co_await 가능한 이동 명령
+ *
+ * 이동을 명령한 뒤 모터가 정지할 때까지 코루틴을 중단합니다.
+ * isMoving()을 폴링하는 대신 MoveTask 안에서 다음처럼 사용합니다.
+ *
+ *   RollWireMover::ErrorCode result = co_await axis.moveTo(2.0);
+ *
+ * 모터는 스케줄러의 클록으로 진행되어야 합니다. (STEPPED 모드 SimMotor,
+ * SimMotorBank 핸들 등) 즉시 완료되는 모터는 중단 없이 바로 재개합니다.
+ */
+class AsyncMover {
+public:
+  AsyncMover(RollWireMover &mover, Motor &motor, MoveScheduler &scheduler);
+
+  // 이동 명령 대기 객체 (결과: 이동 명령의 ErrorCode)
+  struct MoveAwaiter {
+    MoveScheduler::MotorAwaiter motorAwaiter;
+    RollWireMover::ErrorCode result;
+    bool await_ready() const {
+      return result != RollWireMover::ErrorCode::SUCCESS ||
+             motorAwaiter.await_ready();
+    }
+    void await_suspend(std::coroutine_handle<> handle) {
+      motorAwaiter.await_suspend(handle);
+    }
+    RollWireMover::ErrorCode await_resume() const noexcept { return result; }
+  };
+
+  MoveAwaiter moveTo(double targetPosition);   // 목표 위치로 이동 (m)
+  MoveAwaiter moveRelative(double distance);   // 상대 거리 이동 (m)
+  MoveAwaiter executeQueue();                  // 이동 큐 실행
+  MoveScheduler::DelayAwaiter dwell(double seconds); // 정지 대기 (초)
+
+  RollWireMover &getMover();
+  Motor &getMotor();
+
+private:
+  RollWireMover &mover;
+  Motor &motor;
+  MoveScheduler &scheduler;
+
+  MoveAwaiter awaitMotion(RollWireMover::ErrorCode result);
+};
+
+#endif // ASYNCMOVER_H
@@ -0,0 +1,137 @@
+#ifndef MOTIONTRACE_H
+#define MOTIONTRACE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief MotionTrace - 이동 실행 추적 이벤트 기록 및 Chrome 추적 형식 내보내기
+ *
+ * 계획, 모터 전달, 실행(구간 전환, 스텝, 정지) 시점을 타임스탬프와 함께
+ * 스레드별 고정 크기 링 버퍼에 기록합니다. 기록은 잠금 없이 자기 스레드
+ * 버퍼에만 쓰며, 버퍼가 가득 차면 가장 오래된 이벤트부터 덮어씁니다.
+ * 스레드 버퍼는 스레드가 처음 기록할 때 한 번만 할당·등록되고 프로세스가
+ * 끝날 때까지 유지되므로, 종료된 스레드(계획 작업자 등)의 이벤트도 내보낼 수
+ * 있습니다.
+ *
+ * 비활성 상태의 기록 비용은 원자적 플래그 읽기 한 번입니다. 빌드 설정
+ * ROLLWIREMOVER_ENABLE_TRACE=OFF(ROLLWIREMOVER_DISABLE_TRACE 정의)이면
+ * isEnabled()가 상수 false가 되어 기록 코드가 컴파일에서 제거됩니다.
+ *
+ * 내보내기 형식은 Chrome 추적 JSON(chrome://tracing, Perfetto UI에서 열림)
+ * 입니다. 이벤트 이름과 분류는 정적 수명 문자열(리터럴)이어야 합니다.
+ */
+class MotionTrace {
+public:
+  // 이벤트 종류 (Chrome 추적 형식의 ph 값)
+  enum class Phase : char {
+    BEGIN = 'B',   // 구간 시작
+    END = 'E',     // 구간 끝 (같은 스레드의 직전 BEGIN과 짝)
+    INSTANT = 'i', // 순간 이벤트
+    COUNTER = 'C'  // 카운터 값
+  };
+
+  struct Event {
+    const char *name = nullptr;     // 이벤트 이름
+    const char *category = nullptr; // 분류 ("mover", "motor" 등)
+    uint64_t timestampNs = 0;       // steady_clock 기준 시각 (ns)
+    double value = 0.0;             // 카운터 값 / 순간 이벤트 인자
+    uint32_t threadId = 0;          // 기록한 스레드 번호 (1부터)
+    Phase phase = Phase::INSTANT;
+  };
+
+  static constexpr size_t DEFAULT_THREAD_CAPACITY = 65536; // 스레드당 이벤트 수
+
+  // 기록 시작/중단
+  // threadCapacity는 이후 처음 기록하는 스레드의 버퍼에만 적용됩니다. 이미
+  // 버퍼가 있는 스레드는 잠금 없이 기록하므로 크기를 바꾸지 않고 유지합니다.
+  static void enable(size_t threadCapacity = DEFAULT_THREAD_CAPACITY);
+  static void disable();
+  static bool isEnabled() {
+#ifdef ROLLWIREMOVER_DISABLE_TRACE
+    return false;
+#else
+    return enabled.load(std::memory_order_relaxed);
+#endif
+  }
+  static bool isAvailable(); // 빌드에서 추적이 제거되지 않았는지
+
+  // 이벤트 기록 (비활성이면 아무것도 하지 않음)
+  static void begin(const char *name, const char *category) {
+    if (isEnabled()) {
+      record(name, category, Phase::BEGIN, 0.0);
+    }
+  }
+  static void end(const char *name, const char *category) {
+    if (isEnabled()) {
+      record(name, category, Phase::END, 0.0);
+    }
+  }
+  static void instant(const char *name, const char *category,
+                      double value = 0.0) {
+    if (isEnabled()) {
+      record(name, category, Phase::INSTANT, value);
+    }
+  }
+  static void counter(const char *name, const char *category, double value) {
+    if (isEnabled()) {
+      record(name, category, Phase::COUNTER, value);
+    }
+  }
+
+  // 기록된 이벤트 (모든 스레드, 시각순)
+  // 기록 중에 호출해도 안전하며, 읽는 동안 덮어써진 이벤트는 제외합니다.
+  static std::vector<Event> collect();
+  static uint64_t droppedEvents(); // 버퍼가 가득 차 덮어쓴 이벤트 수
+  static void clear();             // 지금까지 기록된 이벤트 버림
+
+  // Chrome 추적 JSON 내보내기 (파일 쓰기 실패 시 false)
+  static void exportChromeTrace(std::ostream &out);
+  static bool exportChromeTrace(const std::string &path);
+
+private:
+  friend class MotionTraceScope;
+
+  static std::atomic<bool> enabled;
+
+  static void record(const char *name, const char *category, Phase phase,
+                     double value);
+};
+
+/**
+ * @brief MotionTraceScope - 범위 동안의 BEGIN/END 구간 기록
+ *
+ * 시작을 기록했으면 도중에 비활성화되어도 끝을 기록하고, 시작을 기록하지
+ * 않았으면 끝도 기록하지 않아 짝이 어긋나지 않습니다.
+ */
+class MotionTraceScope {
+public:
+  MotionTraceScope(const char *name, const char *category)
+      : name(name), category(category), active(MotionTrace::isEnabled()) {
+    if (active) {
+      MotionTrace::record(name, category, MotionTrace::Phase::BEGIN, 0.0);
+    }
+  }
+  ~MotionTraceScope() { finish(); }
+
+  // 범위가 끝나기 전에 구간 끝 기록
+  void finish() {
+    if (active) {
+      MotionTrace::record(name, category, MotionTrace::Phase::END, 0.0);
+      active = false;
+    }
+  }
+  MotionTraceScope(const MotionTraceScope &) = delete;
+  MotionTraceScope &operator=(const MotionTraceScope &) = delete;
+
+private:
+  const char *name;
+  const char *category;
+  bool active;
+};
+
+#endif // MOTIONTRACE_H
@@ -0,0 +1,80 @@
+#ifndef MOTIONTRAJECTORY_H
+#define MOTIONTRAJECTORY_H
+
+#include <cstddef>
+#include <memory>
+
+class SpoolGeometry;
+
+/**
+ * @brief MotionTrajectory - 사다리꼴 이동의 매개변수 표현
+ *
+ * 회전량 샘플 배열 대신 구간별 샘플 수, 최고 속도, 롤 형상만으로 한 번의
+ * 이동을 기술합니다. k번째 샘플의 속도/누적 거리/회전량을 O(1)로 평가할 수
+ * 있으므로, 모터 구현체는 배열 없이 실행 중에 설정값을 직접 계산할 수 있습니다.
+ *
+ * 샘플 배치는 RollWireMover의 속도 프로파일과 동일합니다:
+ * [가속 accSteps][정속 constSteps][감속 decSteps][마지막 0]
+ *
+ * 회전량 평가에 필요한 롤 형상과 시작 위치의 회전량은 prepare()에서 한 번만
+ * 만들어 보관합니다. (복사본은 같은 형상을 공유) 형상이나 시작 위치를 바꾼
+ * 뒤 prepare()를 다시 호출하지 않으면 rotationAt()은 매번 형상을 새로
+ * 만들어 계산합니다.
+ */
+struct MotionTrajectory {
+  // 샘플링
+  double controlPeriod = 0.001; // 샘플 간격 (초)
+
+  // 구간 샘플 수
+  size_t accSteps = 0;   // 가속 구간 샘플 수
+  size_t constSteps = 0; // 정속 구간 샘플 수
+  size_t decSteps = 0;   // 감속 구간 샘플 수
+
+  // 속도
+  double peakVelocity = 0.0; // 최고(정속) 속도 (m/s)
+  double accRampTime = 1.0;  // 0 → peakVelocity 램프 기준 시간 (초)
+  double decRampTime = 1.0;  // peakVelocity → 0 램프 기준 시간 (초)
+
+  // 회전량 기준
+  double startRotation = 0.0; // 시작 회전량 (도)
+  double startPosition = 0.0; // 시작 와이어 위치 (m)
+  double direction = 1.0;     // +1: 내림(풀기), -1: 올림(감기)
+
+  // 롤 형상 (SpoolGeometry 참조)
+  double wireThickness = 1.0;   // 와이어 두께 (mm)
+  double innerRadius = 1.0;     // 롤 내경 반지름 (mm)
+  double totalWireLength = 5.0; // 전체 와이어 길이 (m)
+
+  // 전체 샘플 수 (마지막 0 샘플 포함)
+  size_t sampleCount() const;
+
+  // 전체 실행 시간 (초)
+  double duration() const;
+
+  // k번째 샘플의 속도 (m/s)
+  double velocityAt(size_t k) const;
+
+  // 0..k번째 샘플까지 누적 이동 거리 (m)
+  double distanceAt(size_t k) const;
+
+  // k번째 샘플의 목표 회전량 (도)
+  double rotationAt(size_t k) const;
+
+  // 마지막 샘플의 목표 회전량 (도)
+  double finalRotation() const;
+
+  // 롤 형상과 시작 위치 회전량을 미리 계산 (이미 현재 값 기준이면 유지)
+  void prepare();
+
+private:
+  std::shared_ptr<const SpoolGeometry> spool; // prepare()에서 만든 형상
+  double preparedWireThickness = 0.0;         // spool을 만든 형상 값
+  double preparedInnerRadius = 0.0;
+  double preparedTotalWireLength = 0.0;
+  double preparedStartPosition = 0.0;
+  double startSpoolRotation = 0.0; // startPosition의 회전량 (도)
+
+  bool isPrepared() const;
+};
+
+#endif // MOTIONTRAJECTORY_H
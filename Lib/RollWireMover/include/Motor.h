@@ -1,6 +1,8 @@
 #ifndef MOTOR_H
 #define MOTOR_H
 
+#include "MotionTrajectory.h"
+#include <memory>
 #include <vector>
 
 /**
@@ -19,12 +21,45 @@ public:
     virtual void executeRotationProfile(const std::vector<double>& rotations) = 0;
     virtual void stop() = 0;
 
+    // 회전량 배열 소유권 이전 (복사 없이 전달)
+    // 기본 구현은 const& 버전으로 전달하므로, 복사를 피하려면 재정의합니다.
+    virtual void executeRotationProfile(std::vector<double>&& rotations) {
+        executeRotationProfile(static_cast<const std::vector<double>&>(rotations));
+    }
+
+    // 회전량 배열 공유 소유권 전달 (호출 측 버퍼를 그대로 참조)
+    // nullptr이면 아무 동작도 하지 않습니다.
+    virtual void executeRotationProfile(
+        std::shared_ptr<const std::vector<double>> rotations) {
+        if (rotations) {
+            executeRotationProfile(*rotations);
+        }
+    }
+
+    // 매개변수 궤적 실행
+    // 온보드 프로파일을 지원하는 구현체는 재정의하여 궤적을 직접 평가합니다.
+    // 기본 구현은 궤적을 회전량 배열로 전개하여 executeRotationProfile()에
+    // 전달합니다.
+    virtual void executeTrajectory(const MotionTrajectory &trajectory) {
+        std::vector<double> rotations;
+        rotations.reserve(trajectory.sampleCount());
+        for (size_t k = 0; k < trajectory.sampleCount(); ++k) {
+            rotations.push_back(trajectory.rotationAt(k));
+        }
+        executeRotationProfile(std::move(rotations));
+    }
+
     // 상태 조회 (순수 가상 함수)
     virtual double getCurrentRotation() const = 0;
     virtual bool isRunning() const = 0;
 
     // 리셋 (순수 가상 함수)
     virtual void resetPosition() = 0;
+
+    // 제어 주기 설정 (초)
+    // 회전량 배열의 샘플 간격을 전달받습니다. 고정 주기로 동작하는 구현체는
+    // 기본 구현(무시)을 그대로 사용할 수 있습니다.
+    virtual void setControlPeriod(double period) { (void)period; }
 };
 
 #endif // MOTOR_H
@@ -0,0 +1,86 @@
+#ifndef MOTORDYNAMICS_H
+#define MOTORDYNAMICS_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 모터/롤 동역학 모델 파라미터
+ *
+ * 회전량은 외부에서 도(degree) 단위로 주고받고, 내부 적분은 라디안 단위로
+ * 수행합니다. 롤 관성은 감긴 와이어 양에 비례하여 증가합니다.
+ * (회전량 0도 = 와이어가 완전히 감긴 상태, 풀수록 회전량 증가)
+ */
+struct MotorDynamicsParams {
+  double motorInertia = 0.002;     // 모터 회전자 관성 (kg·m²)
+  double spoolInertia = 0.01;      // 빈 롤 관성 (kg·m²)
+  double wireInertiaPerTurn = 0.0; // 감긴 와이어 1바퀴당 추가 관성 (kg·m²)
+  double fullyWoundTurns = 0.0;    // 회전량 0도에서 감겨 있는 바퀴 수
+  double kp = 200.0;               // 위치 비례 이득 (N·m/rad)
+  double ki = 50.0;                // 위치 적분 이득 (N·m/(rad·s))
+  double kd = 3.0;                 // 속도 오차 이득 (N·m·s/rad)
+  double maxTorque = 20.0;         // 토크 포화 한계 (N·m)
+  int substeps = 10;               // 제어 주기당 고정 적분 서브스텝 수
+};
+
+/**
+ * @brief 추종 오차 통계 (목표 회전량 - 실제 회전량, 도)
+ */
+struct FollowingErrorStats {
+  double maxAbsError = 0.0; // 최대 절대 오차
+  double rmsError = 0.0;    // RMS 오차
+  size_t samples = 0;       // 집계한 제어 주기 수
+};
+
+/**
+ * @brief MotorDynamicsBank - 여러 축의 동역학 상태를 SoA로 보관하는 적분기
+ *
+ * 각 상태(각도, 각속도, 적분항 등)를 축별 연속 배열에 저장하여 한 스레드에서
+ * 수백 개 축을 캐시 친화적으로 적분합니다. 제어 주기마다 목표 회전량을 받아
+ * PID 위치 루프 → 토크 포화 → 반암시적 오일러 적분을 고정 서브스텝으로
+ * 수행합니다. 목표값은 서브스텝 사이에서 선형 보간합니다.
+ */
+class MotorDynamicsBank {
+public:
+  explicit MotorDynamicsBank(
+      const MotorDynamicsParams &params = MotorDynamicsParams());
+
+  // 축 관리
+  size_t addAxis(double initialRotation); // 축 추가, 인덱스 반환
+  size_t size() const;
+  void resetAxis(size_t axis, double rotation); // 상태/통계 초기화
+
+  // 모든 축을 한 제어 주기만큼 진행 (setpoints: 축별 목표 회전량, 도)
+  void advance(const double *setpoints, double period);
+
+  // 한 축만 한 제어 주기만큼 진행
+  void advanceAxis(size_t axis, double setpoint, double period);
+
+  // 상태 조회
+  double getRotation(size_t axis) const; // 실제 회전량 (도)
+  double getVelocity(size_t axis) const; // 각속도 (도/초)
+  double getTorque(size_t axis) const;   // 마지막 서브스텝 토크 (N·m)
+  double getInertia(size_t axis) const;  // 현재 총 관성 (kg·m²)
+  FollowingErrorStats getFollowingErrorStats(size_t axis) const;
+  const MotorDynamicsParams &getParams() const;
+
+private:
+  MotorDynamicsParams params;
+
+  // 축별 상태 (SoA, 라디안 단위)
+  std::vector<double> angle;         // 실제 각도
+  std::vector<double> velocity;      // 각속도
+  std::vector<double> integral;      // 위치 오차 적분
+  std::vector<double> lastSetpoint;  // 직전 제어 주기의 목표 각도
+  std::vector<double> torque;        // 마지막 토크
+  std::vector<double> maxAbsError;   // 최대 절대 추종 오차 (라디안)
+  std::vector<double> sumSquaredErr; // 추종 오차 제곱합 (라디안²)
+  std::vector<size_t> errorSamples;  // 집계한 제어 주기 수
+  std::vector<double> scratchTargets; // advance()용 목표 각도 버퍼
+
+  // [begin, end) 축 적분 (targets[k]: begin+k 축의 목표 각도, 라디안)
+  void integrate(size_t begin, size_t end, const double *targets,
+                 double period);
+};
+
+#endif // MOTORDYNAMICS_H
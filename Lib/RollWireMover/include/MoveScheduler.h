@@ -0,0 +1,143 @@
+#ifndef MOVESCHEDULER_H
+#define MOVESCHEDULER_H
+
+// C++20 코루틴 계층 (선택 빌드: rollwiremover_coro 타깃)
+#include "Motor.h"
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <vector>
+
+class MoveScheduler;
+
+/**
+ * @brief MoveTask - 이동 시퀀스 코루틴
+ *
+ * MoveScheduler::spawn()으로 스케줄러에 넘기거나, 다른 MoveTask 안에서
+ * co_await하여 하위 시퀀스로 실행합니다. 생성 직후에는 실행되지 않습니다.
+ */
+class MoveTask {
+public:
+  struct promise_type {
+    std::coroutine_handle<> continuation; // co_await한 상위 코루틴
+    MoveScheduler *scheduler = nullptr;   // spawn된 최상위 작업이면 설정
+    size_t slot = 0;                      // 스케줄러 소유 목록 내 위치
+    std::exception_ptr exception;
+
+    MoveTask get_return_object() {
+      return MoveTask(
+          std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // 종료 시 상위 코루틴으로 바로 전환하거나 스케줄러에 완료를 알림
+    struct FinalAwaiter {
+      bool await_ready() noexcept { return false; }
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+      void await_resume() noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void return_void() {}
+    void unhandled_exception() { exception = std::current_exception(); }
+  };
+
+  MoveTask(MoveTask &&other) noexcept;
+  MoveTask &operator=(MoveTask &&other) noexcept;
+  MoveTask(const MoveTask &) = delete;
+  MoveTask &operator=(const MoveTask &) = delete;
+  ~MoveTask();
+
+  // 하위 시퀀스로 co_await (대칭 전환, 완료 후 예외 전파)
+  bool await_ready() const noexcept { return !handle || handle.done(); }
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting);
+  void await_resume();
+
+private:
+  friend class MoveScheduler;
+  explicit MoveTask(std::coroutine_handle<promise_type> handle)
+      : handle(handle) {}
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief MoveScheduler - 모터 스텝 클록으로 구동하는 단일 스레드 코루틴 스케줄러
+ *
+ * step()은 클록 함수(예: SimMotorBank::stepAll)로 플랜트를 한 제어 주기
+ * 진행한 뒤, 기다리던 모터가 정지했거나 대기 시간이 끝난 코루틴을 재개합니다.
+ * 축마다 OS 스레드를 두지 않고 수천 개의 이동 시퀀스를 한 스레드에서
+ * 실행할 수 있습니다. 스레드 안전하지 않습니다.
+ */
+class MoveScheduler {
+public:
+  // controlPeriod: 클록 한 번의 시간 (초), advanceClock: 플랜트를 한 주기 진행
+  MoveScheduler(double controlPeriod, std::function<void()> advanceClock);
+  ~MoveScheduler(); // 남은 코루틴 프레임 해제
+
+  MoveScheduler(const MoveScheduler &) = delete;
+  MoveScheduler &operator=(const MoveScheduler &) = delete;
+
+  // 작업 등록 (첫 대기 지점까지 즉시 실행)
+  void spawn(MoveTask task);
+
+  // 실행
+  size_t step();                            // 한 주기, 재개한 코루틴 수 반환
+  size_t runUntilIdle(size_t maxTicks = SIZE_MAX); // 진행한 주기 수 반환
+
+  // 대기 객체
+  struct MotorAwaiter {
+    MoveScheduler &scheduler;
+    Motor &motor;
+    bool await_ready() const { return !motor.isRunning(); }
+    void await_suspend(std::coroutine_handle<> handle);
+    void await_resume() const noexcept {}
+  };
+  struct DelayAwaiter {
+    MoveScheduler &scheduler;
+    uint64_t ticks;
+    bool await_ready() const noexcept { return ticks == 0; }
+    void await_suspend(std::coroutine_handle<> handle);
+    void await_resume() const noexcept {}
+  };
+  MotorAwaiter waitForMotor(Motor &motor); // 모터가 정지할 때까지
+  DelayAwaiter delay(double seconds);      // 제어 주기 단위로 반올림
+
+  // 상태 조회
+  size_t getActiveTaskCount() const; // 완료되지 않은 최상위 작업 수
+  size_t getWaitingCount() const;    // 대기 중인 코루틴 수
+  uint64_t getTick() const;          // 진행한 주기 수
+  double getElapsedTime() const;     // 진행한 시간 (초)
+  uint64_t getResumeCount() const;   // 누적 재개 횟수
+  double getControlPeriod() const;
+
+private:
+  friend struct MoveTask::promise_type::FinalAwaiter;
+
+  // 대기 항목 (motor가 nullptr이면 시간 대기)
+  struct Waiter {
+    std::coroutine_handle<> handle;
+    Motor *motor;
+    uint64_t wakeTick;
+  };
+
+  double controlPeriod;
+  std::function<void()> advanceClock;
+  uint64_t tick;
+  uint64_t resumeCount;
+  size_t activeTasks;
+
+  std::vector<Waiter> waiting;                // 대기 중
+  std::vector<std::coroutine_handle<>> ready; // 이번 주기에 재개할 코루틴
+  std::vector<std::coroutine_handle<MoveTask::promise_type>> finished;
+  std::vector<std::coroutine_handle<MoveTask::promise_type>> tasks; // 소유
+  std::exception_ptr pendingException; // 최상위 작업에서 발생한 예외
+
+  void onTaskFinished(std::coroutine_handle<MoveTask::promise_type> handle);
+  void releaseFinished(); // 완료된 최상위 작업 해제, 예외 전파
+};
+
+#endif // MOVESCHEDULER_H
@@ -0,0 +1,62 @@
+#ifndef ONLINECALIBRATOR_H
+#define ONLINECALIBRATOR_H
+
+#include "SeqLock.h"
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @brief OnlineCalibrator - 이동마다 와이어 두께/롤 내경을 갱신하는 RLS 추정기
+ *
+ * RollWireMover의 좌표(위치 s = 풀린 길이, 회전량 φ = 모두 감긴 상태
+ * 기준)에서 연속 증가 모델은 회전수 m = φ/360 에 대해
+ *
+ *   s(m) = a × m - β × m²   [m]
+ *   a = 2π × outerRadius / 1000  (모두 감긴 상태의 유효 반지름)
+ *   β = π × wireThickness / 1000
+ *
+ * 로 계수에 대해 선형이므로, 2변수 재귀 최소제곱(망각 계수 λ)으로 표본마다
+ * O(1)에 갱신합니다. 내경은 전체 와이어 길이 L = a·N - β·N² 를 만족하는
+ * 감긴 회전수 N에서 innerRadius = outerRadius - N × wireThickness 로 구합니다.
+ *
+ * 스레드 안전성: addSample()은 내부 잠금으로 직렬화되고, 추정값은 SeqLock으로
+ * 게시되므로 getEstimate()/getVersion()은 잠그지 않습니다.
+ */
+class OnlineCalibrator {
+public:
+  struct Estimate {
+    double wireThickness; // 추정 와이어 두께 (mm)
+    double innerRadius;   // 추정 롤 내경 반지름 (mm)
+    double residual;      // 마지막 표본의 사전 잔차 (m)
+    uint64_t samples;     // 반영한 표본 수
+  };
+
+  // 초기 추정값(공칭 형상)과 전체 와이어 길이(m)로 시작
+  // forgettingFactor: 1.0이면 모든 표본 동일 가중, 작을수록 최근 표본 중시
+  // priorWeight: 초기 추정값의 신뢰도 (클수록 표본이 추정을 천천히 바꿈)
+  OnlineCalibrator(double wireThickness, double innerRadius,
+                   double totalWireLength, double forgettingFactor = 1.0,
+                   double priorWeight = 1e-6);
+
+  // 측정 위치(m)와 모터 회전량(도, 모두 감긴 상태 기준) 표본 반영
+  // 입력이 유효하지 않거나 추정값이 물리적으로 불가능하면 게시하지 않고 false
+  bool addSample(double position, double rotation);
+
+  Estimate getEstimate() const; // 마지막으로 게시된 추정값 (잠금 없음)
+  uint64_t getVersion() const;  // 추정값 게시 횟수 (잠금 없음)
+
+private:
+  std::mutex updateMutex;
+  double outerCoefficient; // a
+  double wireCoefficient;  // β
+  double covariance[2][2]; // P
+  double forgettingFactor; // λ
+  double totalWireLength;  // m
+  uint64_t samples;
+  SeqLock<Estimate> estimate;
+
+  // 계수 → 두께/내경 변환 (불가능하면 false)
+  bool toGeometry(double &wireThickness, double &innerRadius) const;
+};
+
+#endif // ONLINECALIBRATOR_H
@@ -0,0 +1,108 @@
+#ifndef PLANTSIMULATOR_H
+#define PLANTSIMULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 플랜트 시뮬레이션 이벤트
+ *
+ * time(초)에 axis번 축에 적용되는 명령입니다.
+ */
+struct PlantEvent {
+  enum class Type {
+    MOVE_TO,         // value: 목표 와이어 위치 (m)
+    STOP,            // 진행 중인 이동 중단 (value 미사용)
+    SET_INNER_RADIUS // value: 새 롤 내경 반지름 (mm)
+  };
+
+  double time = 0.0; // 이벤트 시각 (초)
+  size_t axis = 0;   // 대상 축
+  Type type = Type::MOVE_TO;
+  double value = 0.0;
+};
+
+/**
+ * @brief 축별 시뮬레이션 결과
+ */
+struct AxisReport {
+  size_t eventsProcessed = 0; // 처리한 이벤트 수 (재배치 제외)
+  size_t deferredEvents = 0;  // 이동 중이라 완료 시각으로 미룬 이벤트 수
+  size_t movesCompleted = 0;  // 끝까지 완료한 이동 수
+  size_t movesStopped = 0;    // STOP으로 중단된 이동 수
+  size_t movesRejected = 0;   // RollWireMover가 거부한 이동 수
+  double busyTime = 0.0;      // 모터가 이동 중이던 총 시간 (초)
+  double finishTime = 0.0;    // 마지막 이벤트/이동 종료 시각 (초)
+  double utilization = 0.0;   // busyTime / 전체 사이클 시간
+  double finalPosition = 0.0; // 종료 시 와이어 위치 (m)
+};
+
+/**
+ * @brief 전체 시뮬레이션 결과
+ */
+struct PlantReport {
+  std::vector<AxisReport> axes;
+  size_t totalEvents = 0;     // 처리한 이벤트 수
+  size_t totalMoves = 0;      // 완료 + 중단된 이동 수
+  double cycleTime = 0.0;     // 전체 사이클 시간 (모든 축의 finishTime 최댓값)
+  double movesPerSecond = 0.0; // 시뮬레이션 시간 기준 처리량 (이동/초)
+};
+
+/**
+ * @brief PlantSimulator - 여러 RollWireMover 축을 구동하는 이산 사건 시뮬레이터
+ *
+ * 각 축은 SimMotor(STEPPED, 타임워프) + RollWireMover(PARAMETRIC 궤적)로
+ * 구성되며, 이벤트 사이의 구간은 샘플을 하나씩 평가하지 않고 건너뜁니다.
+ * 축들은 서로 독립이므로 스레드 풀에서 병렬로 처리하며, 결과는 스레드 수와
+ * 무관하게 항상 같습니다. 같은 시각의 이벤트는 등록 순서대로 처리합니다.
+ *
+ * 이동 중인 축에 도착한 MOVE_TO / SET_INNER_RADIUS 이벤트는 이동 완료 시각으로
+ * 미뤄지고, STOP 이벤트는 즉시 이동을 중단합니다.
+ */
+class PlantSimulator {
+public:
+  enum class ErrorCode {
+    SUCCESS,
+    INVALID_AXIS_COUNT,
+    INVALID_AXIS,
+    INVALID_TIME,
+    INVALID_PARAMETER
+  };
+
+  // 축 공통 설정 (RollWireMover 설정 범위를 벗어나면 INVALID_PARAMETER)
+  struct Config {
+    size_t axisCount = 1;
+    double wireThickness = 1.0;    // mm
+    double innerRadius = 50.0;     // mm
+    double maxWireLength = 5.0;    // m
+    double constantVelocity = 0.1; // m/s
+    double controlPeriod = 0.001;  // 초
+    size_t threadCount = 0;        // 0이면 하드웨어 스레드 수
+  };
+
+  PlantSimulator(const Config &config, ErrorCode &outError);
+
+  // 이벤트 등록
+  ErrorCode schedule(const PlantEvent &event);
+
+  // 결정적 난수 교대 근무 스케줄 생성 (축별 시드 = {seed, axis})
+  // duration 동안 평균 meanInterval 간격으로 이벤트를 생성합니다.
+  // (이동 90%, 중단 5%, 롤 교체 5%)
+  ErrorCode scheduleShift(double duration, double meanInterval,
+                          uint64_t seed);
+
+  size_t getScheduledEventCount() const;
+  void clear();
+
+  // 시뮬레이션 실행 (등록된 이벤트는 유지되므로 반복 실행 가능)
+  PlantReport run() const;
+
+private:
+  Config config;
+  std::vector<std::vector<PlantEvent>> axisEvents; // 축별 등록 순서 이벤트
+
+  AxisReport simulateAxis(const std::vector<PlantEvent> &events) const;
+};
+
+#endif // PLANTSIMULATOR_H
@@ -2,14 +2,32 @@
 #define ROLLWIREMOVER_H
 
 #include "Motor.h"
+#include "MotionTrajectory.h"
+#include "SeqLock.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
-// RollWireCalculator 전방 선언 (실제 구현은 나중에)
-class RollWireCalculator;
+// 전방 선언 (구현: SpoolGeometry.h, SpoolSnapshot.h, OnlineCalibrator.h)
+class SpoolGeometry;
+struct SpoolSnapshot;
+class OnlineCalibrator;
 
 /**
  * @brief RollWireMover 클래스
  *
  * 롤에 감긴 와이어의 이동을 제어하는 클래스입니다.
+ *
+ * 스레드 안전성: 설정 변경과 이동 명령은 내부 명령 잠금으로 직렬화됩니다.
+ * 모션 파라미터는 불변 블록을 원자적으로 교체하여 게시(RCU 방식)하고, 위치와
+ * 상태는 SeqLock으로 게시하므로 상태/파라미터 조회는 명령 실행을 막지
+ * 않습니다. (테스트용 getLast*() 참조 반환 메서드는 제외)
  */
 class RollWireMover {
 public:
@@ -24,7 +42,16 @@ public:
     INVALID_VELOCITY,
     INVALID_MAX_LENGTH,
     OUT_OF_RANGE,
-    MOTOR_BUSY
+    MOTOR_BUSY,
+    INVALID_CONTROL_PERIOD,
+    INVALID_MOTOR_LIMITS,
+    INVALID_DWELL_TIME,
+    NO_PLANNED_MOVE,
+    INVALID_MOTION_CONFIG,
+    SNAPSHOT_IO_ERROR,
+    INVALID_SNAPSHOT,
+    CALIBRATOR_NOT_SET,
+    INVALID_CAPTURE_CONFIG
   };
 
   // 생성자
@@ -42,11 +69,118 @@ public:
 
   // 속도 프로파일 타입
   enum class ProfileType {
-    TRAPEZOID, // 사다리꼴 프로파일
-    S_CURVE    // S자 곡선 프로파일
+    TRAPEZOID,   // 사다리꼴 프로파일
+    S_CURVE,     // S자 곡선 프로파일
+    MINIMUM_TIME // 모터 한계 내 최단 시간 프로파일 (반지름에 따라 속도 변화)
+  };
+
+  // 샘플 양자화 방식
+  enum class QuantizationMode {
+    ROUNDED,       // 구간 시간을 샘플 단위로 반올림 (기본값)
+    EXACT_DISTANCE // 이산 적분 거리가 요청 거리와 정확히 일치하도록 보정
+  };
+
+  // 모터 전달 방식
+  enum class TrajectoryMode {
+    SAMPLED,   // 회전량 샘플 배열 전달 (기본값)
+    PARAMETRIC // 매개변수 궤적(MotionTrajectory) 전달, 모터가 직접 평가
+  };
+
+  // 계획 공간
+  enum class PlanningSpace {
+    WIRE,    // 와이어 길이 기준 가감속 (와이어 속도 일정, 기본값)
+    ROTATION // 회전 각도 기준 가감속 (모터 RPM 일정, 와이어 속도는 반지름 따라 변화)
+  };
+
+  // 위치/상태 일관 스냅샷
+  struct Status {
+    double position;   // 현재 와이어 위치 (m)
+    MotionState state; // 모션 상태
+    uint64_t moveCount; // 위치를 바꾼 명령 수 (moveTo, 큐, stop)
+  };
+
+  // 모션 설정 입력값 (검증 전, 기본값 포함)
+  struct MotionSettings {
+    double accelerationTime = 0.1;      // 가속 시간 (초)
+    double constantVelocity = 0.1;      // 정속 속도 (m/s)
+    double decelerationTime = 0.1;      // 감속 시간 (초)
+    double controlPeriod = DEFAULT_CONTROL_PERIOD; // 샘플링(제어) 주기 (초)
+    double maxWireLength = 5.0;         // 최대 와이어 길이 (m)
+    double maxMotorRpm = DEFAULT_MAX_MOTOR_RPM; // 모터 최대 회전 속도 (RPM)
+    double maxAngularAcceleration =
+        DEFAULT_MAX_ANGULAR_ACCELERATION; // 모터 최대 각가속도 (도/초²)
+    double constantRpm = DEFAULT_CONSTANT_RPM; // ROTATION 공간 정속 RPM
+    ProfileType profile = ProfileType::TRAPEZOID;
+    QuantizationMode quantizationMode = QuantizationMode::ROUNDED;
+    TrajectoryMode trajectoryMode = TrajectoryMode::SAMPLED;
+    PlanningSpace planningSpace = PlanningSpace::WIRE;
+  };
+
+  /**
+   * @brief MotionConfig - 불변 모션 설정
+   *
+   * create()에서 한 번 검증하고, 이동 계획에 쓰이는 파생 상수(램프 샘플 수,
+   * 가감속 거리, 각속도 한계, 위치 ↔ 회전량 변환 계수)를 미리 계산합니다.
+   * 항상 shared_ptr<const MotionConfig>로 전달되며 생성 후 바뀌지 않습니다.
+   *
+   * 형상에 의존하는 스풀 변환(getSpool())은 처음 사용할 때 한 번만 만들어
+   * 지므로, withInnerRadius()로 롤만 바꾼 설정은 램프 상수를 그대로 재사용하고
+   * 스풀 변환만 다음 이동 계획 시 다시 계산합니다.
+   */
+  class MotionConfig : public MotionSettings {
+  public:
+    static std::shared_ptr<const MotionConfig>
+    create(const MotionSettings &settings, double wireThickness,
+           double innerRadius, ErrorCode &outError);
+
+    // 형상만 바꾼 설정 (설정값 재검증/램프 상수 재계산 없음, 0 이하면 nullptr)
+    std::shared_ptr<const MotionConfig>
+    withGeometry(double wireThickness, double innerRadius) const;
+    std::shared_ptr<const MotionConfig> withInnerRadius(double radius) const;
+
+    MotionConfig(const MotionConfig &) = delete;
+    MotionConfig &operator=(const MotionConfig &) = delete;
+
+    const MotionSettings &getSettings() const { return *this; }
+
+    // 형상
+    double wireThickness; // 와이어 두께 (mm)
+    double innerRadius;   // 계산기 내경 반지름 (mm)
+    const SpoolGeometry &getSpool() const; // 위치 ↔ 회전량 변환 (지연 생성)
+    bool hasSpool() const;                 // 스풀 변환 생성 여부
+    // 스풀 변환을 결정하는 값(두께, 내경, 최대 길이)이 같은지
+    bool hasSameSpool(const MotionConfig &other) const;
+
+    // 파생 상수
+    double accelerationDistance; // 정속 속도까지 가속 거리 (m)
+    double decelerationDistance; // 정속 속도에서 감속 거리 (m)
+    int accelerationSteps;       // 가속 구간 샘플 수 (반올림)
+    int decelerationSteps;       // 감속 구간 샘플 수 (반올림)
+    int exactAccelerationSteps;  // 가속 구간 샘플 수 (올림, EXACT_DISTANCE)
+    int exactDecelerationSteps;  // 감속 구간 샘플 수 (올림, EXACT_DISTANCE)
+    double maxAngularVelocityRad;     // 모터 최대 각속도 (rad/s)
+    double maxAngularAccelerationRad; // 모터 최대 각가속도 (rad/s²)
+
+  private:
+    explicit MotionConfig(const MotionSettings &settings)
+        : MotionSettings(settings) {}
+
+    mutable std::once_flag spoolOnce;
+    mutable std::shared_ptr<const SpoolGeometry> spool;
+    mutable std::atomic<bool> spoolReady{false};
   };
 
-  // 상태 조회
+  // 모션 설정 일괄 조회/변경
+  std::shared_ptr<const MotionConfig> getMotionConfig() const; // 게시된 설정
+  // 현재 형상으로 설정 생성 (검증 실패 시 nullptr)
+  std::shared_ptr<const MotionConfig>
+  makeMotionConfig(const MotionSettings &settings, ErrorCode &outError) const;
+  // 여러 파라미터를 한 번에 게시 (nullptr 또는 형상(최대 길이 포함)이 다르면
+  // INVALID_MOTION_CONFIG)
+  ErrorCode setMotionConfig(std::shared_ptr<const MotionConfig> config);
+
+  // 상태 조회 (잠금 없음)
+  Status getStatus() const;
   double getCurrentPosition() const;   // 현재 위치 조회 (m)
   MotionState getCurrentState() const; // 현재 상태 조회
   bool isMoving() const;               // 이동 중 여부
@@ -57,49 +191,328 @@ public:
   ErrorCode setDecelerationTime(double time);     // 감속 시간 설정 (초)
 
   // 시스템 설정
-  ErrorCode setMaxWireLength(double length); // 최대 와이어 길이 설정 (m)
-  ErrorCode setInnerRadius(double radius);   // 롤 내경 변경 (mm)
+  // 최대 와이어 길이 설정 (m, 스풀 모델 교체). 이동 중이면 MOTOR_BUSY
+  ErrorCode setMaxWireLength(double length);
+  // 롤 내경 변경 (mm, 스풀 교체). 이동 중이면 MOTOR_BUSY
+  ErrorCode setInnerRadius(double radius);
+  double getInnerRadius() const;             // 롤 내경 조회 (mm)
+  ErrorCode setControlPeriod(double period); // 제어 주기 설정 (초)
+  double getControlPeriod() const;           // 제어 주기 조회 (초)
+
+  // 모터 한계 설정 (MINIMUM_TIME 프로파일에서 사용)
+  // maxRpm이 정속 RPM(getConstantRpm())보다 작으면 ROTATION 공간 이동은
+  // maxRpm으로 계획합니다 (정속 RPM 설정값은 유지)
+  ErrorCode setMotorLimits(double maxRpm, double maxAngularAcceleration);
+  double getMaxMotorRpm() const;              // 최대 회전 속도 (RPM)
+  double getMaxAngularAcceleration() const;   // 최대 각가속도 (도/초²)
 
   // 속도 프로파일 설정
   void setVelocityProfile(ProfileType type); // 속도 프로파일 타입 설정
+  void setQuantizationMode(QuantizationMode mode); // 샘플 양자화 방식 설정
+  QuantizationMode getQuantizationMode() const;    // 샘플 양자화 방식 조회
+  void setTrajectoryMode(TrajectoryMode mode);     // 모터 전달 방식 설정
+  TrajectoryMode getTrajectoryMode() const;        // 모터 전달 방식 조회
+  void setPlanningSpace(PlanningSpace space);      // 계획 공간 설정
+  PlanningSpace getPlanningSpace() const;          // 계획 공간 조회
+  ErrorCode setConstantRpm(double rpm); // ROTATION 공간 정속 회전 속도 (RPM)
+  double getConstantRpm() const;        // ROTATION 공간 정속 회전 속도 조회
 
-  // 이동 명령
+  // 이동 명령 (모터가 이전 이동을 실행 중이면 MOTOR_BUSY)
   ErrorCode moveTo(double targetPosition); // 목표 위치로 이동 (m)
+  // 주어진 설정으로 이동 (재검증 없음, 제어 주기와 형상은 현재와 같아야 함)
+  // 온라인 보정 추정값은 반영하지 않음 (다음 moveTo(target)에서 반영)
+  ErrorCode moveTo(double targetPosition, const MotionConfig &config);
   ErrorCode moveRelative(double distance); // 상대 거리 이동 (m)
+  void stop(); // 이동 중단 (모터 회전량으로 현재 위치 재계산)
+
+  // 이동 큐 (레시피 실행)
+  // 같은 방향으로 이어지는 이동은 경유점에서 멈추지 않고 속도를 이어서
+  // 계획하며, 전체 큐를 하나의 회전량 배열로 모터에 전달합니다.
+  ErrorCode queueMove(double targetPosition, double velocity = 0.0); // 0: 기본 정속 속도
+  ErrorCode queueDwell(double seconds); // 정지 대기 (초)
+  ErrorCode executeQueue();             // 큐 실행 후 비움 (이동 중이면 MOTOR_BUSY)
+  void clearQueue();
+  size_t getQueuedCount() const;
+
+  // 비동기 계획 (이중 버퍼)
+  // 현재 이동이 실행되는 동안 다음 이동을 백그라운드 스레드에서 계획합니다.
+  // 계획은 호출 시점의 파라미터 사본과 마지막으로 명령한 이동의 끝 상태를
+  // 기준으로 하며, executePlannedMove()는 완료된 계획 버퍼를 실행 버퍼와
+  // 교체한 뒤 모터에 전달합니다. 실행 전 다른 이동 명령이 있었으면 현재
+  // 상태 기준으로 다시 계획합니다.
+  std::shared_future<ErrorCode> planMove(double targetPosition);
+  ErrorCode executePlannedMove(); // 계획 완료까지 대기 후 실행
+  bool hasPlannedMove() const;    // 실행 대기 중인 계획 여부
+
+  // 비동기 계획 지연 통계
+  struct PlanningStats {
+    size_t plansRequested = 0;    // planMove 호출 수
+    size_t plansExecuted = 0;     // executePlannedMove로 실행한 계획 수
+    size_t readyBeforeNeeded = 0; // 실행 시점에 이미 완료되어 있던 계획 수
+    size_t stalePlans = 0;        // 계획 이후 상태가 바뀌어 다시 계획한 수
+    double totalPlanTime = 0.0;   // 백그라운드 계획 시간 합 (초)
+    double maxPlanTime = 0.0;     // 최대 계획 시간 (초)
+    double totalWaitTime = 0.0;   // 실행 시 계획 완료 대기 시간 합 (초)
+    double maxWaitTime = 0.0;     // 최대 대기 시간 (초)
+
+    // 실행 시점에 계획이 준비되어 있던 비율 (0~1)
+    double readyRate() const {
+      return plansExecuted == 0
+                 ? 0.0
+                 : static_cast<double>(readyBeforeNeeded) / plansExecuted;
+    }
+  };
+  PlanningStats getPlanningStats() const;
+  void resetPlanningStats();
+
+  // 스풀 상태 스냅샷 (재시작 시 원점 복귀 없이 복원)
+  // 경로를 지정하면 모터가 정지 상태로 끝난 이동, stop(), 스풀 교체마다
+  // 스냅샷을 원자적으로 기록합니다. durable이면 rename 전에 fsync 합니다.
+  void enableSnapshots(const std::string &path, bool durable = true);
+  void disableSnapshots();
+  ErrorCode writeSnapshot(); // 즉시 기록 (이동 중이면 MOTOR_BUSY)
+  // 웜 스타트: 모터 회전량이 스냅샷과 다르거나 와이어 두께가 다르면
+  // INVALID_SNAPSHOT (원점 복귀 필요)
+  ErrorCode restoreSnapshot(const std::string &path);
+  ErrorCode restoreSnapshot(const SpoolSnapshot &snapshot);
+
+  struct SnapshotStats {
+    size_t writes = 0;          // 기록 성공 수
+    size_t failures = 0;        // 기록 실패 수
+    double totalWriteTime = 0.0; // 기록 시간 합 (초)
+    double maxWriteTime = 0.0;   // 최대 기록 시간 (초)
+  };
+  SnapshotStats getSnapshotStats() const;
+
+  // 이동당 힙 할당 집계 (AllocationTracker.h)
+  // 할당 훅(rollwiremover_alloc_hook)을 링크한 실행 파일에서만 값이 채워집니다.
+  // moveTo/moveRelative/executeQueue의 계획부터 모터 전달까지를 한 이동으로
+  // 집계하며, 그동안 다른 스레드가 한 할당도 함께 포함됩니다.
+  struct AllocationStats {
+    bool tracking = false;          // 할당 훅 연결 여부 (false면 나머지 0)
+    uint64_t moves = 0;             // 집계한 이동 수
+    uint64_t lastAllocations = 0;   // 마지막 이동의 할당 횟수
+    uint64_t lastBytes = 0;         // 마지막 이동의 할당 바이트
+    int64_t lastPeakBytes = 0;      // 마지막 이동 중 힙 증가 최고점 (바이트)
+    uint64_t totalAllocations = 0;  // 누적 할당 횟수
+    uint64_t totalBytes = 0;        // 누적 할당 바이트
+    int64_t maxPeakBytes = 0;       // 이동 중 힙 증가 최고점의 최댓값
+  };
+  AllocationStats getAllocationStats() const;
+  void resetAllocationStats();
+
+  // 온라인 보정 (OnlineCalibrator.h)
+  // 보정기가 새 추정값을 게시하면 다음 이동 명령이 원자적 버전 비교 한 번으로
+  // 감지하여 형상을 교체하고, 모터 회전량에서 현재 위치를 다시 계산합니다.
+  void setOnlineCalibrator(std::shared_ptr<OnlineCalibrator> calibrator);
+  // 정지 상태에서 측정한 실제 와이어 위치(m)를 모터 회전량과 함께 보정기에
+  // 전달 (보정기 없으면 CALIBRATOR_NOT_SET, 이동 중이면 MOTOR_BUSY)
+  ErrorCode recordMeasuredPosition(double measuredPosition);
+
+  // 속도 프로파일 기록 (디버그용)
+  // OFF     : 기록하지 않음 (프로파일은 모터 전달 후 바로 해제)
+  // LAST    : 마지막 이동만 기록 (getLastVelocityProfile())
+  // HISTORY : 최근 historyDepth개 이동을 링 버퍼에 기록
+  // 기록은 벡터 버퍼 교환이므로 복사가 없습니다. maxSamples > 0이면 더 긴
+  // 프로파일은 기록 시 제자리에서 솎아 냅니다. 기본 모드는 빌드 설정
+  // ROLLWIREMOVER_PROFILE_CAPTURE_DEFAULT (기본 LAST)로 정합니다.
+  enum class ProfileCaptureMode { OFF, LAST, HISTORY };
+  struct CapturedProfile {
+    uint64_t sequence = 0;        // 이동 명령 순번 (getStatus().moveCount)
+    size_t decimation = 1;        // 솎음 간격 (1이면 모든 샘플)
+    std::vector<double> velocity; // 속도 프로파일 (m/s)
+  };
+  // 프로파일 기록 기본 링 버퍼 크기 (이동 수)
+  static constexpr size_t DEFAULT_PROFILE_HISTORY = 16;
+  // HISTORY에서 historyDepth가 0이면 INVALID_CAPTURE_CONFIG
+  ErrorCode setProfileCapture(ProfileCaptureMode mode,
+                              size_t historyDepth = DEFAULT_PROFILE_HISTORY,
+                              size_t maxSamples = 0);
+  ProfileCaptureMode getProfileCaptureMode() const;
+  std::vector<CapturedProfile> getProfileHistory() const; // 오래된 순 사본
 
   // 테스트용 메서드
+  // (HISTORY 모드에서는 가장 최근 기록, OFF 모드에서는 빈 배열)
   const std::vector<double> &getLastVelocityProfile() const;
+  const MotionTrajectory &getLastTrajectory() const;
 
 private:
-  RollWireCalculator *calculator; // 길이-회전량 변환기
-  Motor *motor;                   // 모터 제어 객체 (의존성 주입)
+  Motor *motor; // 모터 제어 객체 (의존성 주입)
 
-  // 상태 변수
+  // 상태 변수 (commandMutex 보호, 조회용 사본은 status)
   double currentPosition;   // 현재 와이어 위치 (m, 0 = 완전히 올림)
   MotionState currentState; // 현재 모션 상태
-  double maxWireLength;     // 최대 와이어 길이 (m, 기본값 5.0)
+  double moveStartPosition; // 마지막 이동 시작 위치 (m)
+  double moveStartRotation; // 마지막 이동 시작 시 모터 회전량 (도)
+
+  // 동시성
+  mutable std::mutex commandMutex; // 설정 변경/이동 명령 직렬화
+  SeqLock<Status> status;          // 잠금 없는 위치/상태 조회
 
-  // 모션 파라미터
-  double accelerationTime; // 가속 시간 (초)
-  double constantVelocity; // 정속 속도 (m/s)
-  double decelerationTime; // 감속 시간 (초)
+  // 이동 큐 항목
+  struct QueuedMotion {
+    bool isDwell;       // true면 대기, false면 이동
+    double target;      // 목표 위치 (m)
+    double velocity;    // 구간 정속 속도 (m/s)
+    double dwellTime;   // 대기 시간 (초)
+  };
+  std::vector<QueuedMotion> motionQueue;
+
+  // 게시된 모션 설정 (불변, 변경 시 새 설정을 만들어 원자적으로 교체)
+  // 계획 함수와 백그라운드 계획 스레드는 게시된 설정만 읽음
+  std::shared_ptr<const MotionConfig> parameters; // atomic_load/store로 접근
+  // 생성자 검증 결과 (실패 시 설정이 게시되지 않으며 설정 메서드가 반환)
+  ErrorCode constructionError;
 
-  // 시스템 파라미터
-  double innerRadius;         // 롤 내경 반지름 (mm)
-  ProfileType currentProfile; // 현재 속도 프로파일 타입
+  // 계획 결과 (이중 버퍼의 한 칸)
+  struct PlannedMotion {
+    ErrorCode result = ErrorCode::SUCCESS;
+    double startPosition = 0.0;  // 시작 위치 (m)
+    double targetPosition = 0.0; // 목표 위치 (m)
+    double endRotation = 0.0;    // 이동 종료 시 모터 회전량 (도)
+    bool parametric = false;     // true면 trajectory, false면 rotations 전달
+    MotionTrajectory trajectory;
+    std::vector<double> rotations;
+    std::vector<double> velocityProfile;
+    uint64_t sequence = 0; // 계획 시점의 이동 명령 순번
+    double innerRadius = 0.0;   // 계획 시점의 롤 내경 (mm)
+    double wireThickness = 0.0; // 계획 시점의 와이어 두께 (mm)
+  };
+
+  // 백그라운드 계획 작업
+  struct PlanRequest {
+    std::shared_ptr<const MotionConfig> config;
+    double startPosition;
+    double startRotation;
+    double targetPosition;
+    PlannedMotion *buffer; // 결과를 채울 뒤 버퍼
+    std::promise<ErrorCode> promise;
+  };
+
+  // 비동기 계획 상태
+  std::unique_ptr<PlannedMotion> activePlan;  // 앞 버퍼 (마지막 실행 계획)
+  std::unique_ptr<PlannedMotion> pendingPlan; // 뒤 버퍼 (계획 중/실행 대기)
+  std::shared_future<ErrorCode> pendingFuture;
+  std::unique_ptr<PlanRequest> planRequest; // 작업 슬롯 (planMutex 보호)
+  std::thread planWorker;                   // 첫 planMove 시 시작
+  mutable std::mutex planMutex;
+  std::condition_variable planCondition;
+  bool planWorkerExit;
+  PlanningStats planningStats; // planMutex 보호
+  uint64_t motionSequence;     // 이동 명령(moveTo, 큐, stop)마다 증가
+  double commandedEndRotation; // 마지막 명령 이동 종료 시 모터 회전량 (도)
+
+  // 온라인 보정 (commandMutex 보호)
+  std::shared_ptr<OnlineCalibrator> calibrator;
+  uint64_t appliedCalibrationVersion; // 마지막으로 반영한 추정값 버전
+
+  // 스냅샷 (commandMutex 보호)
+  std::string snapshotPath; // 비어 있으면 자동 기록 안 함
+  bool snapshotDurable;
+  SnapshotStats snapshotStats;
+
+  // 할당 집계 (commandMutex 보호)
+  struct AllocationMark {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    int64_t liveBytes = 0;
+  };
+  AllocationStats allocationStats;
+
+  // 속도 프로파일 기록 (commandMutex 보호)
+  ProfileCaptureMode profileCapture;
+  std::vector<double> lastVelocityProfile;     // LAST 모드 기록
+  std::vector<CapturedProfile> profileHistory; // HISTORY 링 버퍼
+  size_t profileHistoryNext;  // 다음 기록 위치
+  size_t profileHistoryCount; // 기록된 이동 수 (최대 profileHistory.size())
+  size_t profileMaxSamples;   // 0이면 솎지 않음
 
   // 테스트용 변수
-  std::vector<double> lastVelocityProfile; // 마지막으로 생성된 속도 프로파일
+  MotionTrajectory lastTrajectory; // 마지막으로 전달된 매개변수 궤적
 
   // 속도 제한 상수
   static constexpr double MAX_VELOCITY = 1.0;  // 최대 속도 (m/s)
   static constexpr double MIN_VELOCITY = 0.01; // 최소 속도 (m/s)
 
+  // 제어 주기 제한 상수
+  static constexpr double DEFAULT_CONTROL_PERIOD = 0.001; // 기본 주기 (1kHz)
+  static constexpr double MAX_CONTROL_PERIOD = 0.1;       // 최대 주기 (10Hz)
+
+  // 모터 한계 기본값
+  static constexpr double DEFAULT_MAX_MOTOR_RPM = 150.0;
+  static constexpr double DEFAULT_MAX_ANGULAR_ACCELERATION = 720.0; // 도/초²
+  static constexpr double DEFAULT_CONSTANT_RPM = 30.0;
+
+  // 웜 스타트 허용 모터 회전량 차이 (도)
+  static constexpr double SNAPSHOT_ROTATION_TOLERANCE = 0.01;
+
+  // 경로 계획(최단 시간, 이동 큐) 위치 격자 간격 (m)과 최대 격자 수
+  static constexpr double PATH_GRID_STEP = 0.001;
+  static constexpr size_t PATH_MAX_GRID_SEGMENTS = 100000;
+
   // 내부 헬퍼 메서드
-  std::vector<double> generateVelocityProfile(double distance);
-  std::vector<double>
-  convertToRotationProfile(const std::vector<double> &velocityProfile,
-                           bool isRetracting);
+  // 계획 함수는 불변 MotionConfig만 사용하므로 백그라운드 스레드에서도
+  // 호출할 수 있습니다.
+  std::shared_ptr<const MotionConfig> currentParameters() const;
+  // 게시된 설정값 (생성 실패로 게시된 설정이 없으면 기본값)
+  MotionSettings currentSettings() const;
+  // 설정 검증 후 게시 (commandMutex 보유 시)
+  ErrorCode publishSettings(const MotionSettings &settings);
+  void publishParameters(std::shared_ptr<const MotionConfig> next);
+  ErrorCode writeSnapshotLocked();
+  void applyCalibrationIfUpdated(); // 모터 정지 시에만 형상 교체
+  void applyGeometry(std::shared_ptr<const MotionConfig> config);
+  double rotationFromOrigin() const; // 위치 0 기준 모터 회전량 (도)
+  void snapshotIfIdle(); // 자동 기록 (모터가 정지해 있을 때만)
+  // 모드에 따라 프로파일 기록 (버퍼 교환, velocityProfile에는 이전 버퍼가 남음)
+  void captureVelocityProfile(std::vector<double> &velocityProfile,
+                              uint64_t sequence);
+  AllocationMark beginMoveAllocations() const; // 이동 시작 시점의 할당 집계
+  void endMoveAllocations(const AllocationMark &mark); // 이동 한 번 반영
+  void publishStatus();                                 // commandMutex 보유 시
+  ErrorCode moveToLocked(double targetPosition, const MotionConfig &config);
+  static void planMotion(const MotionConfig &p, double startPosition,
+                         double startRotation, double targetPosition,
+                         PlannedMotion &plan);
+  void startMotion(PlannedMotion &plan); // 계획 결과를 모터에 전달
+  void planWorkerLoop();
+  static std::vector<double>
+  generateMinimumTimeProfile(const MotionConfig &p, double startPosition,
+                             double targetPosition);
+  // 반환: 회전량 배열, wireVelocity: 주기 평균 와이어 속도
+  static std::vector<double>
+  generateRotationSpaceProfile(const MotionConfig &p, double startPosition,
+                               double startRotation, double targetPosition,
+                               std::vector<double> &wireVelocity);
+  static std::vector<double>
+  planBlendedRun(const MotionConfig &p, double startPosition,
+                 const std::vector<double> &waypoints,
+                 const std::vector<double> &cruise);
+  static size_t pathGridSegments(double distance);
+  // 위치 격자별 속도/가감속 한계 경로를 최단 시간으로 샘플링 (양 끝 정지)
+  static std::vector<double>
+  timeParameterizePath(const MotionConfig &p, double distance,
+                       const std::vector<double> &velocityLimit,
+                       const std::vector<double> &accelLimit,
+                       const std::vector<double> &decelLimit);
+  static MotionTrajectory planTrajectory(const MotionConfig &p,
+                                         double distance);
+  // 가감속 구간 계획 (distance와 cruiseVelocity는 같은 단위: m 또는 도)
+  static MotionTrajectory planRamp(const MotionConfig &p, double distance,
+                                   double cruiseVelocity);
+  static MotionTrajectory planRoundedTrajectory(const MotionConfig &p,
+                                                double distance,
+                                                double cruiseVelocity);
+  static MotionTrajectory planExactDistanceTrajectory(const MotionConfig &p,
+                                                      double distance,
+                                                      double cruiseVelocity);
+  static std::vector<double>
+  sampleVelocityProfile(const MotionTrajectory &trajectory);
+  static std::vector<double>
+  convertToRotationProfile(const MotionConfig &p,
+                           const std::vector<double> &velocityProfile,
+                           bool isRetracting, double startPosition,
+                           double startRotation);
 };
 
 #endif // ROLLWIREMOVER_H
@@ -0,0 +1,92 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief SeqLock - 단일 기록자 / 다중 독자 순서 잠금
+ *
+ * 기록 중에는 순번이 홀수가 되고, 독자는 읽기 전후 순번이 같은 짝수일 때만
+ * 값을 받아들입니다. 독자는 기록자를 막지 않으며, 기록자도 독자를 기다리지
+ * 않습니다. 값은 64비트 원자 워드에 나누어 저장하므로 찢어진 읽기가 정의되지
+ * 않은 동작이 되지 않습니다. 기록자가 여럿이면 호출 측에서 직렬화해야 합니다.
+ */
+template <typename T> class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SeqLock value must be trivially copyable");
+
+public:
+  SeqLock() : sequence(0) {
+    for (std::atomic<uint64_t> &word : words) {
+      word.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  explicit SeqLock(const T &value) : SeqLock() { store(value); }
+
+  SeqLock(const SeqLock &) = delete;
+  SeqLock &operator=(const SeqLock &) = delete;
+
+  // 기록 (단일 기록자)
+  void store(const T &value) {
+    uint64_t buffer[WORDS] = {};
+    std::memcpy(buffer, &value, sizeof(T));
+
+    uint64_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; i++) {
+      words[i].store(buffer[i], std::memory_order_relaxed);
+    }
+    sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  // 읽기 (기록 중이면 재시도)
+  T load() const {
+    T value;
+    uint64_t version;
+    while (!tryLoad(value, version)) {
+      std::this_thread::yield();
+    }
+    return value;
+  }
+
+  // 한 번만 읽기 시도 (기록 중이거나 읽는 도중 바뀌면 false, value 불변)
+  // 성공하면 version에 읽은 값까지의 기록 횟수를 돌려줍니다.
+  bool tryLoad(T &value, uint64_t &version) const {
+    uint64_t buffer[WORDS];
+    uint64_t before = sequence.load(std::memory_order_acquire);
+    if ((before & 1) != 0) {
+      return false;
+    }
+    for (size_t i = 0; i < WORDS; i++) {
+      buffer[i] = words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) != before) {
+      return false;
+    }
+    std::memcpy(&value, buffer, sizeof(T));
+    version = before / 2;
+    return true;
+  }
+
+  // 지금까지의 기록 횟수
+  uint64_t version() const {
+    return sequence.load(std::memory_order_acquire) / 2;
+  }
+
+private:
+  static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) /
+                                  sizeof(uint64_t);
+
+  std::atomic<uint64_t> sequence;
+  std::atomic<uint64_t> words[WORDS];
+};
+
+#endif // SEQLOCK_H
@@ -2,7 +2,10 @@
 #define SIMMOTOR_H
 
 #include "Motor.h"
+#include "MotorDynamics.h"
 #include <cstddef>
+#include <functional>
+#include <memory>
 
 /**
  * @brief SimMotor 클래스 - Motor 인터페이스의 시뮬레이션 구현체
@@ -12,29 +15,90 @@
  */
 class SimMotor : public Motor {
 public:
+  // 실행 방식
+  enum class ExecutionMode {
+    IMMEDIATE, // executeRotationProfile() 호출 시 즉시 완료 (기본값)
+    STEPPED    // 로드 후 실행 상태로 두고 step()/stepN()/runUntil()로 진행
+  };
+
+  // 배치 스텝 중 주기적으로 호출되는 콜백
+  using StepCallback = std::function<void(const SimMotor &)>;
+
   // 생성자
   SimMotor();
 
   // Motor 인터페이스 구현
   void executeRotationProfile(const std::vector<double> &rotations) override;
+  void executeRotationProfile(std::vector<double> &&rotations) override;
+  void executeRotationProfile(
+      std::shared_ptr<const std::vector<double>> rotations) override;
+  void executeTrajectory(const MotionTrajectory &trajectory) override;
   void stop() override;
   double getCurrentRotation() const override;
   bool isRunning() const override;
   void resetPosition() override;
+  void setControlPeriod(double period) override;
+
+  // 재시작 복원: 모터가 꺼져 있는 동안 유지된 회전량(절대 엔코더)을 재현
+  void restoreRotation(double rotation);
+
+  // 제어 주기 및 시뮬레이션 시간 조회
+  double getControlPeriod() const; // 제어 주기 (초)
+  double getElapsedTime() const;   // 실행된 샘플의 누적 시간 (초)
 
   // 단계별 실행을 위한 추가 메서드
   void loadProfile(const std::vector<double> &rotations);
+  void loadProfile(std::vector<double> &&rotations);
+  void loadProfile(std::shared_ptr<const std::vector<double>> rotations);
+  void loadTrajectory(const MotionTrajectory &trajectory);
   void startExecution();
   void step();
 
+  // 배치 실행 (빠른 시뮬레이션)
+  size_t stepN(size_t count);  // 최대 count 샘플 진행, 실제 진행 수 반환
+                               // (콜백이 stop()하면 그 시점에서 멈춤)
+  size_t runUntil(double time); // 누적 시간이 time(초)에 도달할 때까지 진행
+  void setStepCallback(StepCallback callback, size_t interval);
+  void setTimeWarp(bool enabled); // 중간 샘플 평가 생략 (오프라인 시뮬레이션)
+  void setExecutionMode(ExecutionMode mode);
+  ExecutionMode getExecutionMode() const;
+
+  // 동역학 모델 (관성, PID 위치 루프, 토크 포화)
+  // 활성화하면 목표 회전량으로 즉시 이동하지 않고 고정 서브스텝으로 적분하며,
+  // 타임워프 설정은 무시됩니다.
+  void enableDynamics(const MotorDynamicsParams &params);
+  void disableDynamics();
+  bool isDynamicsEnabled() const;
+  FollowingErrorStats getFollowingErrorStats() const;
+
   // 테스트용 메서드
   const std::vector<double> &getLastProfile() const;
+  const MotionTrajectory &getLastTrajectory() const;
+  bool hasTrajectory() const; // 매개변수 궤적을 실행 중(또는 마지막 실행)인지
 
 private:
   double currentRotation;      // 현재 회전 각도 (도)
   bool running;                // 동작 상태
-  std::vector<double> profile; // 실행 중인 프로파일
+  std::shared_ptr<const std::vector<double>> profile; // 실행 중인 프로파일
+  MotionTrajectory trajectory; // 실행 중인 매개변수 궤적
+  bool trajectoryLoaded;       // true면 profile 대신 trajectory를 평가
   size_t currentIndex;         // 현재 실행 인덱스
+  double controlPeriod;        // 샘플 간격 (초)
+  double elapsedTime;          // 누적 시뮬레이션 시간 (초)
+  ExecutionMode executionMode; // 실행 방식
+  bool timeWarp;               // 중간 샘플 평가 생략 여부
+  StepCallback stepCallback;   // 배치 스텝 콜백
+  size_t callbackInterval;     // 콜백 호출 간격 (샘플)
+  size_t callbackCounter;      // 마지막 콜백 이후 진행한 샘플 수
+  MotorDynamicsBank dynamics;  // 동역학 상태 (1축)
+  bool dynamicsEnabled;        // 동역학 모델 사용 여부
+
+  size_t loadedSampleCount() const; // 로드된 프로파일/궤적의 샘플 수
+  void runProfile(std::shared_ptr<const std::vector<double>> rotations);
+  void storeProfile(std::shared_ptr<const std::vector<double>> rotations);
+  double sampleAt(size_t index) const; // 로드된 프로파일/궤적의 index번째 값
+  void advanceSamples(size_t count);   // 콜백 없이 count 샘플 진행
+  void traceAdvance(size_t begin, size_t end) const; // 스텝 추적 이벤트
 };
 
 #endif // SIMMOTOR_H
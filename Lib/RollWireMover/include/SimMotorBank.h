@@ -0,0 +1,73 @@
+#ifndef SIMMOTORBANK_H
+#define SIMMOTORBANK_H
+
+#include "Motor.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief SimMotorBank - 여러 시뮬레이션 모터를 SoA로 묶어 한 번에 진행하는 엔진
+ *
+ * 모든 모터의 프로파일을 하나의 연속 버퍼(arena)에 저장하고, 각 모터의 상태
+ * (현재 회전량, 재생 위치, 길이)를 모터별 연속 배열에 보관합니다.
+ * stepAll()은 분기 없는 단일 루프로 모든 모터를 한 샘플씩 진행합니다.
+ *
+ * 각 모터는 motor(i)가 반환하는 Motor 핸들로 RollWireMover에 주입할 수
+ * 있습니다. 핸들의 executeRotationProfile()은 프로파일을 적재만 하고
+ * 즉시 반환하며, 실제 진행은 stepAll() 호출 시 이루어집니다.
+ * (SimMotor의 STEPPED 모드와 동일한 동작)
+ */
+class SimMotorBank {
+public:
+  explicit SimMotorBank(double controlPeriod = 0.001);
+  ~SimMotorBank();
+
+  // 복사/이동 불가 (핸들이 뱅크 주소를 보관)
+  SimMotorBank(const SimMotorBank &) = delete;
+  SimMotorBank &operator=(const SimMotorBank &) = delete;
+
+  // 모터 관리
+  size_t addMotor();           // 모터 추가, 인덱스 반환
+  size_t size() const;
+  Motor &motor(size_t index); // index번째 모터의 Motor 핸들
+
+  // 모든 모터를 진행
+  void stepAll();                   // 한 샘플
+  void stepAll(size_t count);       // count 샘플
+  size_t runUntilIdle();            // 모든 모터가 정지할 때까지, 진행한 샘플 수
+  size_t getRunningCount() const;   // 실행 중인 모터 수
+
+  // 모터별 상태 조회
+  double getCurrentRotation(size_t index) const;
+  bool isRunning(size_t index) const;
+
+  // 제어 주기 및 시뮬레이션 시간
+  void setControlPeriod(double period); // 모든 모터가 공유
+  double getControlPeriod() const;
+  double getElapsedTime() const; // stepAll()로 진행한 누적 시간 (초)
+
+private:
+  class BankMotor; // Motor 인터페이스 핸들
+
+  double controlPeriod;
+  double elapsedTime;
+
+  // 모터별 상태 (SoA)
+  std::vector<double> rotation; // 현재 회전 각도 (도)
+  std::vector<size_t> offset;   // arena 내 프로파일 시작 위치
+  std::vector<size_t> length;   // 프로파일 샘플 수
+  std::vector<size_t> cursor;   // 다음에 재생할 샘플 인덱스
+
+  std::vector<double> arena;    // 모든 모터의 프로파일 샘플
+  size_t compactThreshold;      // arena가 이 크기에 도달하면 compact()
+  std::vector<std::unique_ptr<BankMotor>> handles;
+
+  void load(size_t index, const double *samples, size_t count);
+  void stop(size_t index);
+  void resetPosition(size_t index);
+  void compact(); // 재생이 끝난 구간을 arena에서 제거
+};
+
+#endif // SIMMOTORBANK_H
@@ -0,0 +1,48 @@
+#ifndef SPOOLGEOMETRY_H
+#define SPOOLGEOMETRY_H
+
+#include "RollWireCalculator.h"
+#include <cstddef>
+
+/**
+ * @brief SpoolGeometry - 와이어 위치와 모터 회전량 사이의 변환
+ *
+ * RollWireCalculator의 연속 증가 모델(r(θ) = innerRadius + θ/360 ×
+ * wireThickness)을 RollWireMover의 위치 좌표에 맞춰 사용합니다.
+ *
+ * - 위치 s = 0: 와이어가 모두 감긴 상태 (롤 반지름 최대)
+ * - 위치 s = totalWireLength: 모두 풀린 상태 (롤 반지름 = innerRadius)
+ * - 회전량: s = 0에서 0도, 풀수록 증가
+ *
+ * 즉, 위치 s에서 롤에 감겨 있는 길이는 totalWireLength - s입니다.
+ */
+class SpoolGeometry {
+public:
+  SpoolGeometry(double wireThickness, double innerRadius,
+                double totalWireLength);
+
+  // 위치 s(m)에 해당하는 회전량 (도)
+  double rotationAtPosition(double position) const;
+
+  // 회전량(도)에 해당하는 위치 (m)
+  double positionAtRotation(double rotation) const;
+
+  // 회전량 배열 → 위치 배열 일괄 변환 (calculateLengthsFromRotations 사용)
+  void positionsAtRotations(const double *rotations, double *positions,
+                            size_t count) const;
+
+  // 위치 s(m)에서 롤의 유효 반지름 (mm)
+  double radiusAtPosition(double position) const;
+
+  const RollWireCalculator &getCalculator() const;
+  double getTotalWireLength() const;
+
+private:
+  RollWireCalculator calculator;
+  double totalWireLength; // 롤에 감을 수 있는 전체 와이어 길이 (m)
+  double fullRotation;    // 전체 와이어가 감긴 회전량 (도)
+
+  double woundLength(double position) const; // 0 이상으로 제한
+};
+
+#endif // SPOOLGEOMETRY_H
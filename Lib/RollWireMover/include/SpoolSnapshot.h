@@ -0,0 +1,50 @@
+#ifndef SPOOLSNAPSHOT_H
+#define SPOOLSNAPSHOT_H
+
+#include "RollWireMover.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief SpoolSnapshot - 재시작 시 원점 복귀 없이 복원할 스풀 상태
+ *
+ * 정지 상태의 와이어 위치, 그때의 모터 회전량, 롤 형상, 게시된 모션 설정을
+ * 담습니다. 설정에서 파생되는 상수(MotionConfig)는 저장하지 않고 복원 시
+ * 다시 계산합니다.
+ */
+struct SpoolSnapshot {
+  double position = 0.0;      // 와이어 위치 (m)
+  double motorRotation = 0.0; // 모터 회전량 (도)
+  double wireThickness = 0.0; // 와이어 두께 (mm)
+  double innerRadius = 0.0;   // 롤 내경 반지름 (mm)
+  uint64_t moveCount = 0;     // 저장 시점의 이동 명령 수
+  RollWireMover::MotionSettings settings;
+};
+
+/**
+ * @brief SpoolSnapshotFile - 스냅샷 바이너리 파일 읽기/쓰기
+ *
+ * 형식: 매직("RWSS") + 버전 + 필드별 고정 길이 값 + FNV-1a 체크섬.
+ * 같은 디렉터리의 임시 파일에 write() 후 rename()으로 교체하므로, 쓰는 도중
+ * 전원이 꺼져도 이전 스냅샷이나 새 스냅샷 중 하나만 남습니다.
+ * durable이면 rename 전에 fsync()로 내용을, rename 후 상위 디렉터리를
+ * fsync()하여 교체된 디렉터리 항목까지 디스크에 내립니다.
+ */
+class SpoolSnapshotFile {
+public:
+  static constexpr size_t ENCODED_SIZE = 136; // 파일 크기 (바이트)
+
+  // 인코딩/디코딩 (디코딩 실패: 매직/버전/체크섬 불일치)
+  static void encode(const SpoolSnapshot &snapshot,
+                     uint8_t (&buffer)[ENCODED_SIZE]);
+  static bool decode(const uint8_t (&buffer)[ENCODED_SIZE],
+                     SpoolSnapshot &snapshot);
+
+  // 원자적 쓰기 / 읽기 (실패 시 false)
+  static bool write(const std::string &path, const SpoolSnapshot &snapshot,
+                    bool durable);
+  static bool read(const std::string &path, SpoolSnapshot &snapshot);
+};
+
+#endif // SPOOLSNAPSHOT_H
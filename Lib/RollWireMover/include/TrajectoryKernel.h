@@ -0,0 +1,81 @@
+#ifndef TRAJECTORYKERNEL_H
+#define TRAJECTORYKERNEL_H
+
+#include "MotionTrajectory.h"
+#include "RollWireMath.h"
+#include <cstddef>
+
+/**
+ * @brief 매개변수 궤적의 회전량 샘플을 Scalar 형식으로 생성
+ *
+ * MotionTrajectory::rotationAt()과 같은 샘플 배치를 float, double,
+ * FixedPoint<F> 등으로 계산합니다. 배정밀도가 느린 드라이브는 FixedPoint로
+ * 궤적을 직접 평가할 수 있고, 정수 연산이므로 기계와 컴파일러에 관계없이
+ * 비트 단위로 같은 샘플이 나옵니다.
+ *
+ * 누적 거리는 닫힌 형태 대신 샘플 속도의 합을 샘플링 주파수로 나눠 구합니다.
+ * (닫힌 형태의 n(n-1)/2 항은 긴 이동에서 고정소수점 표현 범위를 넘고,
+ * 샘플마다 v·dt를 더하면 곱셈의 버림 오차가 샘플 수만큼 쌓임)
+ *
+ * @param trajectory 평가할 궤적 (설정값은 double에서 한 번만 변환)
+ * @param rotations  회전량 출력 (도), sampleCount()개 이상
+ * @return 기록한 샘플 수 (capacity가 부족하면 capacity까지만 기록)
+ */
+template <typename Scalar>
+size_t sampleTrajectoryRotations(const MotionTrajectory &trajectory,
+                                 Scalar *rotations, size_t capacity) {
+  typedef RollWireMath<Scalar> Math;
+  const Scalar zero(0.0);
+  const Scalar sampleRate(1.0 / trajectory.controlPeriod);
+  const Scalar peak(trajectory.peakVelocity);
+  const Scalar accSlope(trajectory.peakVelocity * trajectory.controlPeriod /
+                        trajectory.accRampTime);
+  const Scalar decSlope(trajectory.peakVelocity * trajectory.controlPeriod /
+                        trajectory.decRampTime);
+  const Scalar thickness(trajectory.wireThickness);
+  const Scalar radius(trajectory.innerRadius);
+  const Scalar total(trajectory.totalWireLength);
+  const Scalar startPosition(trajectory.startPosition);
+  const Scalar direction(trajectory.direction);
+  const Scalar startRotation(trajectory.startRotation);
+
+  // 감긴 길이 기준 회전량: 위치 s의 회전량 = full - rot(total - s)
+  Scalar startWound = total - startPosition;
+  if (startWound < zero) {
+    startWound = zero;
+  }
+  const Scalar startWoundRotation =
+      Math::rotationFromLength(thickness, radius, startWound);
+
+  size_t count = trajectory.sampleCount();
+  if (count > capacity) {
+    count = capacity;
+  }
+
+  Scalar velocitySum = zero;
+  for (size_t k = 0; k < count; ++k) {
+    // 속도 (velocityAt()과 같은 구간 배치)
+    Scalar velocity = zero;
+    if (k < trajectory.accSteps) {
+      velocity = accSlope * Scalar(static_cast<double>(k));
+    } else if (k < trajectory.accSteps + trajectory.constSteps) {
+      velocity = peak;
+    } else if (k < trajectory.accSteps + trajectory.constSteps +
+                       trajectory.decSteps) {
+      size_t j = k - trajectory.accSteps - trajectory.constSteps;
+      velocity = peak - decSlope * Scalar(static_cast<double>(j));
+    }
+    velocitySum += velocity;
+    Scalar distance = velocitySum / sampleRate;
+
+    Scalar wound = startWound - direction * distance;
+    if (wound < zero) {
+      wound = zero;
+    }
+    rotations[k] = startRotation + startWoundRotation -
+                   Math::rotationFromLength(thickness, radius, wound);
+  }
+  return count;
+}
+
+#endif // TRAJECTORYKERNEL_H
@@ -0,0 +1,63 @@
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+// 전역 operator new/delete 교체 (rollwiremover_alloc_hook 타깃)
+//
+// 실행 파일에 링크해야만 적용됩니다. 해제 시 크기를 알 수 있도록 실제 블록
+// 크기(malloc_usable_size, glibc)로 사용량을 집계합니다. 정렬 지정 할당
+// (align_val_t)은 교체하지 않으므로 집계에서 빠집니다.
+
+namespace {
+
+void *trackedAllocate(size_t size) {
+  void *pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  AllocationTracker::recordAllocation(size, malloc_usable_size(pointer));
+  return pointer;
+}
+
+void *trackedAllocate(size_t size, const std::nothrow_t &) noexcept {
+  void *pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer != nullptr) {
+    AllocationTracker::recordAllocation(size, malloc_usable_size(pointer));
+  }
+  return pointer;
+}
+
+void trackedFree(void *pointer) {
+  if (pointer == nullptr) {
+    return;
+  }
+  AllocationTracker::recordDeallocation(malloc_usable_size(pointer));
+  std::free(pointer);
+}
+
+// 정적 초기화 시점에 훅 연결 표시
+struct HookInstaller {
+  HookInstaller() { AllocationTracker::markInstalled(); }
+} hookInstaller;
+
+} // namespace
+
+void *operator new(size_t size) { return trackedAllocate(size); }
+void *operator new[](size_t size) { return trackedAllocate(size); }
+void *operator new(size_t size, const std::nothrow_t &tag) noexcept {
+  return trackedAllocate(size, tag);
+}
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept {
+  return trackedAllocate(size, tag);
+}
+void operator delete(void *pointer) noexcept { trackedFree(pointer); }
+void operator delete[](void *pointer) noexcept { trackedFree(pointer); }
+void operator delete(void *pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  trackedFree(pointer);
+}
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  trackedFree(pointer);
+}
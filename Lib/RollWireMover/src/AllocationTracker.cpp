@@ -0,0 +1,63 @@
+#include "AllocationTracker.h"
+#include <atomic>
+
+namespace {
+
+std::atomic<bool> installed(false);
+std::atomic<uint64_t> allocations(0);
+std::atomic<uint64_t> deallocations(0);
+std::atomic<uint64_t> bytes(0);
+std::atomic<int64_t> liveBytes(0);
+std::atomic<int64_t> peakLiveBytes(0);
+std::atomic<int64_t> windowPeakBytes(0);
+
+void raise(std::atomic<int64_t> &peak, int64_t value) {
+  int64_t current = peak.load(std::memory_order_relaxed);
+  while (value > current && !peak.compare_exchange_weak(
+                                current, value, std::memory_order_relaxed)) {
+  }
+}
+
+} // namespace
+
+bool AllocationTracker::isInstalled() {
+  return installed.load(std::memory_order_relaxed);
+}
+
+AllocationTracker::Counters AllocationTracker::read() {
+  Counters counters;
+  counters.allocations = allocations.load(std::memory_order_relaxed);
+  counters.deallocations = deallocations.load(std::memory_order_relaxed);
+  counters.bytes = bytes.load(std::memory_order_relaxed);
+  counters.liveBytes = liveBytes.load(std::memory_order_relaxed);
+  counters.peakLiveBytes = peakLiveBytes.load(std::memory_order_relaxed);
+  return counters;
+}
+
+int64_t AllocationTracker::beginWindow() {
+  int64_t live = liveBytes.load(std::memory_order_relaxed);
+  windowPeakBytes.store(live, std::memory_order_relaxed);
+  return live;
+}
+
+int64_t AllocationTracker::windowPeak() {
+  return windowPeakBytes.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::recordAllocation(size_t requested, size_t block) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  bytes.fetch_add(requested, std::memory_order_relaxed);
+  int64_t size = static_cast<int64_t>(block);
+  int64_t live = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+  raise(peakLiveBytes, live);
+  raise(windowPeakBytes, live);
+}
+
+void AllocationTracker::recordDeallocation(size_t block) {
+  deallocations.fetch_add(1, std::memory_order_relaxed);
+  liveBytes.fetch_sub(static_cast<int64_t>(block), std::memory_order_relaxed);
+}
+
+void AllocationTracker::markInstalled() {
+  installed.store(true, std::memory_order_relaxed);
+}
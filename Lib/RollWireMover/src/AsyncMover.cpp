@@ -0,0 +1,31 @@
+#include "AsyncMover.h"
+
+AsyncMover::AsyncMover(RollWireMover &mover, Motor &motor,
+                       MoveScheduler &scheduler)
+    : mover(mover), motor(motor), scheduler(scheduler) {}
+
+AsyncMover::MoveAwaiter AsyncMover::moveTo(double targetPosition) {
+  return awaitMotion(mover.moveTo(targetPosition));
+}
+
+AsyncMover::MoveAwaiter AsyncMover::moveRelative(double distance) {
+  return awaitMotion(mover.moveRelative(distance));
+}
+
+AsyncMover::MoveAwaiter AsyncMover::executeQueue() {
+  return awaitMotion(mover.executeQueue());
+}
+
+MoveScheduler::DelayAwaiter AsyncMover::dwell(double seconds) {
+  return scheduler.delay(seconds);
+}
+
+RollWireMover &AsyncMover::getMover() { return mover; }
+
+Motor &AsyncMover::getMotor() { return motor; }
+
+AsyncMover::MoveAwaiter
+AsyncMover::awaitMotion(RollWireMover::ErrorCode result) {
+  // 이동 명령은 co_await 이전(호출 시점)에 모터로 전달됨
+  return MoveAwaiter{scheduler.waitForMotor(motor), result};
+}
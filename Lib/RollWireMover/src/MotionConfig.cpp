@@ -0,0 +1,124 @@
+#include "RollWireMover.h"
+#include "SpoolGeometry.h"
+#include <algorithm>
+#include <cmath>
+
+std::shared_ptr<const RollWireMover::MotionConfig>
+RollWireMover::MotionConfig::create(const MotionSettings &settings,
+                                    double wireThickness, double innerRadius,
+                                    ErrorCode &outError) {
+  // 입력 검증 (개별 set* 메서드와 같은 에러 코드)
+  if (wireThickness <= 0.0) {
+    outError = ErrorCode::INVALID_WIRE_THICKNESS;
+    return nullptr;
+  }
+  if (innerRadius <= 0.0) {
+    outError = ErrorCode::INVALID_INNER_RADIUS;
+    return nullptr;
+  }
+  if (settings.accelerationTime <= 0.0) {
+    outError = ErrorCode::INVALID_ACCELERATION_TIME;
+    return nullptr;
+  }
+  if (settings.decelerationTime <= 0.0) {
+    outError = ErrorCode::INVALID_DECELERATION_TIME;
+    return nullptr;
+  }
+  if (settings.constantVelocity < MIN_VELOCITY ||
+      settings.constantVelocity > MAX_VELOCITY || settings.constantRpm <= 0.0) {
+    outError = ErrorCode::INVALID_VELOCITY;
+    return nullptr;
+  }
+  if (settings.maxWireLength <= 0.0) {
+    outError = ErrorCode::INVALID_MAX_LENGTH;
+    return nullptr;
+  }
+  if (settings.controlPeriod <= 0.0 ||
+      settings.controlPeriod > MAX_CONTROL_PERIOD) {
+    outError = ErrorCode::INVALID_CONTROL_PERIOD;
+    return nullptr;
+  }
+  if (settings.maxMotorRpm <= 0.0 || settings.maxAngularAcceleration <= 0.0) {
+    outError = ErrorCode::INVALID_MOTOR_LIMITS;
+    return nullptr;
+  }
+
+  std::shared_ptr<MotionConfig> config(new MotionConfig(settings));
+  config->wireThickness = wireThickness;
+  config->innerRadius = innerRadius;
+
+  // 램프 형상 (가속 거리 = 0.5 * v * t_acc)
+  double dt = settings.controlPeriod;
+  config->accelerationDistance =
+      0.5 * settings.constantVelocity * settings.accelerationTime;
+  config->decelerationDistance =
+      0.5 * settings.constantVelocity * settings.decelerationTime;
+  config->accelerationSteps =
+      static_cast<int>(settings.accelerationTime / dt + 0.5);
+  config->decelerationSteps =
+      static_cast<int>(settings.decelerationTime / dt + 0.5);
+
+  // 구간을 정수 샘플 수로 올림 (0.1, 0.2 등의 부동소수점 오차 흡수)
+  const double eps = 1e-9;
+  config->exactAccelerationSteps = std::max(
+      1, static_cast<int>(std::ceil(settings.accelerationTime / dt - eps)));
+  config->exactDecelerationSteps = std::max(
+      1, static_cast<int>(std::ceil(settings.decelerationTime / dt - eps)));
+
+  // 모터 한계 (RPM → rad/s, 도/초² → rad/s²)
+  const double PI = 3.14159265358979323846;
+  config->maxAngularVelocityRad = settings.maxMotorRpm / 60.0 * 2.0 * PI;
+  config->maxAngularAccelerationRad =
+      settings.maxAngularAcceleration * PI / 180.0;
+
+  config->getSpool();
+  outError = ErrorCode::SUCCESS;
+  return config;
+}
+
+std::shared_ptr<const RollWireMover::MotionConfig>
+RollWireMover::MotionConfig::withInnerRadius(double radius) const {
+  return withGeometry(wireThickness, radius);
+}
+
+std::shared_ptr<const RollWireMover::MotionConfig>
+RollWireMover::MotionConfig::withGeometry(double thickness,
+                                          double radius) const {
+  if (thickness <= 0.0 || radius <= 0.0) {
+    return nullptr;
+  }
+
+  // 설정값과 램프/모터 한계 상수는 형상과 무관하므로 그대로 복사
+  std::shared_ptr<MotionConfig> config(new MotionConfig(getSettings()));
+  config->wireThickness = thickness;
+  config->innerRadius = radius;
+  config->accelerationDistance = accelerationDistance;
+  config->decelerationDistance = decelerationDistance;
+  config->accelerationSteps = accelerationSteps;
+  config->decelerationSteps = decelerationSteps;
+  config->exactAccelerationSteps = exactAccelerationSteps;
+  config->exactDecelerationSteps = exactDecelerationSteps;
+  config->maxAngularVelocityRad = maxAngularVelocityRad;
+  config->maxAngularAccelerationRad = maxAngularAccelerationRad;
+  return config;
+}
+
+const SpoolGeometry &RollWireMover::MotionConfig::getSpool() const {
+  // 여러 계획 스레드가 동시에 처음 사용해도 한 번만 생성
+  std::call_once(spoolOnce, [this] {
+    spool = std::make_shared<SpoolGeometry>(wireThickness, innerRadius,
+                                            maxWireLength);
+    spoolReady.store(true, std::memory_order_release);
+  });
+  return *spool;
+}
+
+bool RollWireMover::MotionConfig::hasSpool() const {
+  return spoolReady.load(std::memory_order_acquire);
+}
+
+bool RollWireMover::MotionConfig::hasSameSpool(const MotionConfig &other) const {
+  return wireThickness == other.wireThickness &&
+         innerRadius == other.innerRadius &&
+         maxWireLength == other.maxWireLength;
+}
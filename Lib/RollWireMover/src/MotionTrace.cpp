@@ -0,0 +1,208 @@
+#include "MotionTrace.h"
+#include "SeqLock.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+// 스레드별 링 버퍼 (기록은 소유 스레드만, 읽기는 collect())
+// 칸마다 SeqLock을 두어 독자가 덮어쓰는 중인 칸을 찢어 읽지 않고, 칸의 기록
+// 횟수로 원하는 회차의 이벤트인지 확인합니다.
+struct ThreadBuffer {
+  ThreadBuffer(size_t capacity, uint32_t threadId)
+      : slots(new SeqLock<MotionTrace::Event>[capacity]), capacity(capacity),
+        head(0), base(0), threadId(threadId) {}
+
+  std::unique_ptr<SeqLock<MotionTrace::Event>[]> slots;
+  uint64_t capacity;
+  std::atomic<uint64_t> head; // 누적 기록 수 (다음 기록 위치)
+  std::atomic<uint64_t> base; // clear() 시점의 head
+  uint32_t threadId;
+};
+
+// 등록된 스레드 버퍼 목록 (스레드 종료 후에도 유지)
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+// 다른 정적 객체 소멸 이후에 기록하는 스레드가 있어도 안전하도록 해제하지 않음
+Registry &registry() {
+  static Registry *instance = new Registry();
+  return *instance;
+}
+
+std::atomic<size_t> threadCapacity(MotionTrace::DEFAULT_THREAD_CAPACITY);
+thread_local ThreadBuffer *localBuffer = nullptr;
+
+ThreadBuffer *registerThread() {
+  Registry &instance = registry();
+  std::lock_guard<std::mutex> lock(instance.mutex);
+  size_t capacity = std::max<size_t>(1, threadCapacity.load());
+  uint32_t threadId = static_cast<uint32_t>(instance.buffers.size() + 1);
+  instance.buffers.emplace_back(new ThreadBuffer(capacity, threadId));
+  localBuffer = instance.buffers.back().get();
+  return localBuffer;
+}
+
+uint64_t nowNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+void writeJsonString(std::ostream &out, const char *text) {
+  out << '"';
+  for (const char *c = text != nullptr ? text : ""; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out << '\\' << *c;
+    } else if (static_cast<unsigned char>(*c) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+      out << escaped;
+    } else {
+      out << *c;
+    }
+  }
+  out << '"';
+}
+
+} // namespace
+
+std::atomic<bool> MotionTrace::enabled(false);
+
+void MotionTrace::enable(size_t capacity) {
+  threadCapacity.store(capacity);
+  enabled.store(true, std::memory_order_relaxed);
+}
+
+void MotionTrace::disable() { enabled.store(false, std::memory_order_relaxed); }
+
+bool MotionTrace::isAvailable() {
+#ifdef ROLLWIREMOVER_DISABLE_TRACE
+  return false;
+#else
+  return true;
+#endif
+}
+
+void MotionTrace::record(const char *name, const char *category, Phase phase,
+                         double value) {
+  ThreadBuffer *buffer = localBuffer;
+  if (buffer == nullptr) {
+    buffer = registerThread();
+  }
+
+  Event event;
+  event.name = name;
+  event.category = category;
+  event.timestampNs = nowNs();
+  event.value = value;
+  event.threadId = buffer->threadId;
+  event.phase = phase;
+
+  uint64_t index = buffer->head.load(std::memory_order_relaxed);
+  buffer->slots[index % buffer->capacity].store(event);
+  buffer->head.store(index + 1, std::memory_order_release);
+}
+
+std::vector<MotionTrace::Event> MotionTrace::collect() {
+  std::vector<Event> events;
+  Registry &instance = registry();
+  std::lock_guard<std::mutex> lock(instance.mutex);
+  for (const std::unique_ptr<ThreadBuffer> &buffer : instance.buffers) {
+    uint64_t capacity = buffer->capacity;
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t first = std::max(buffer->base.load(std::memory_order_acquire),
+                              head > capacity ? head - capacity : 0);
+    for (uint64_t i = first; i < head; i++) {
+      // i번째 기록은 그 칸의 (i / capacity + 1)번째 기록. 읽는 동안 덮어쓰는
+      // 중이거나 이미 덮어써진 칸은 제외
+      Event event;
+      uint64_t version;
+      if (buffer->slots[i % capacity].tryLoad(event, version) &&
+          version == i / capacity + 1) {
+        events.push_back(event);
+      }
+    }
+  }
+
+  // 같은 시각이면 스레드 내 기록 순서 유지
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event &a, const Event &b) {
+                     return a.timestampNs < b.timestampNs;
+                   });
+  return events;
+}
+
+uint64_t MotionTrace::droppedEvents() {
+  uint64_t dropped = 0;
+  Registry &instance = registry();
+  std::lock_guard<std::mutex> lock(instance.mutex);
+  for (const std::unique_ptr<ThreadBuffer> &buffer : instance.buffers) {
+    uint64_t recorded = buffer->head.load(std::memory_order_acquire) -
+                        buffer->base.load(std::memory_order_acquire);
+    uint64_t capacity = buffer->capacity;
+    dropped += recorded > capacity ? recorded - capacity : 0;
+  }
+  return dropped;
+}
+
+void MotionTrace::clear() {
+  Registry &instance = registry();
+  std::lock_guard<std::mutex> lock(instance.mutex);
+  for (const std::unique_ptr<ThreadBuffer> &buffer : instance.buffers) {
+    buffer->base.store(buffer->head.load(std::memory_order_acquire),
+                       std::memory_order_release);
+  }
+}
+
+void MotionTrace::exportChromeTrace(std::ostream &out) {
+  std::vector<Event> events = collect();
+  uint64_t origin = events.empty() ? 0 : events.front().timestampNs;
+
+  // 시각은 첫 이벤트 기준 마이크로초 (Chrome 추적 형식 단위)
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  char number[32];
+  for (size_t i = 0; i < events.size(); i++) {
+    const Event &event = events[i];
+    out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+    writeJsonString(out, event.name);
+    out << ",\"cat\":";
+    writeJsonString(out, event.category);
+    std::snprintf(number, sizeof(number), "%.3f",
+                  (event.timestampNs - origin) / 1000.0);
+    out << ",\"ph\":\"" << static_cast<char>(event.phase) << "\",\"ts\":"
+        << number << ",\"pid\":1,\"tid\":" << event.threadId;
+    if (event.phase == Phase::INSTANT) {
+      out << ",\"s\":\"t\"";
+    }
+    if (event.phase == Phase::INSTANT || event.phase == Phase::COUNTER) {
+      // JSON에는 NaN/무한대 표기가 없음
+      if (std::isfinite(event.value)) {
+        std::snprintf(number, sizeof(number), "%.17g", event.value);
+      } else {
+        std::snprintf(number, sizeof(number), "null");
+      }
+      out << ",\"args\":{\"value\":" << number << "}";
+    }
+    out << "}";
+  }
+  out << "\n]}\n";
+}
+
+bool MotionTrace::exportChromeTrace(const std::string &path) {
+  std::ofstream out(path);
+  if (!out) {
+    return false;
+  }
+  exportChromeTrace(out);
+  out.flush();
+  return static_cast<bool>(out);
+}
@@ -0,0 +1,102 @@
+#include "MotionTrajectory.h"
+#include "SpoolGeometry.h"
+
+size_t MotionTrajectory::sampleCount() const {
+  return accSteps + constSteps + decSteps + 1;
+}
+
+double MotionTrajectory::duration() const {
+  return sampleCount() * controlPeriod;
+}
+
+double MotionTrajectory::velocityAt(size_t k) const {
+  double dt = controlPeriod;
+
+  // 가속 구간: v = (t / accRampTime) * peak
+  if (k < accSteps) {
+    double t = k * dt;
+    return (t / accRampTime) * peakVelocity;
+  }
+  k -= accSteps;
+
+  // 정속 구간
+  if (k < constSteps) {
+    return peakVelocity;
+  }
+  k -= constSteps;
+
+  // 감속 구간: v = peak * (1 - t / decRampTime)
+  if (k < decSteps) {
+    double t = k * dt;
+    return peakVelocity * (1.0 - (t / decRampTime));
+  }
+
+  // 마지막 샘플 (정지)
+  return 0.0;
+}
+
+double MotionTrajectory::distanceAt(size_t k) const {
+  double dt = controlPeriod;
+
+  // 앞에서부터 n개 샘플의 합 (닫힌 형태)
+  //   가속: Σ_{i<n} (i·dt/accRampTime)·peak·dt = peak·dt²/accRampTime · n(n-1)/2
+  //   정속: n · peak · dt
+  //   감속: Σ_{j<n} peak·(1 - j·dt/decRampTime)·dt
+  //       = peak·dt · (n - dt/decRampTime · n(n-1)/2)
+  size_t n = k + 1;
+  double distance = 0.0;
+
+  size_t accCount = n < accSteps ? n : accSteps;
+  distance += peakVelocity * dt * dt / accRampTime * 0.5 *
+              static_cast<double>(accCount) * (accCount > 0 ? accCount - 1 : 0);
+  n -= accCount;
+
+  size_t constCount = n < constSteps ? n : constSteps;
+  distance += peakVelocity * dt * constCount;
+  n -= constCount;
+
+  size_t decCount = n < decSteps ? n : decSteps;
+  distance += peakVelocity * dt *
+              (decCount - dt / decRampTime * 0.5 *
+                              static_cast<double>(decCount) *
+                              (decCount > 0 ? decCount - 1 : 0));
+
+  // 마지막 0 샘플은 거리에 기여하지 않음
+  return distance;
+}
+
+double MotionTrajectory::rotationAt(size_t k) const {
+  // 시작 위치 기준 회전량 변화 (반지름 변화 반영)
+  double position = startPosition + direction * distanceAt(k);
+  if (isPrepared()) {
+    return startRotation + spool->rotationAtPosition(position) -
+           startSpoolRotation;
+  }
+  SpoolGeometry geometry(wireThickness, innerRadius, totalWireLength);
+  return startRotation + geometry.rotationAtPosition(position) -
+         geometry.rotationAtPosition(startPosition);
+}
+
+double MotionTrajectory::finalRotation() const {
+  return rotationAt(sampleCount() - 1);
+}
+
+void MotionTrajectory::prepare() {
+  if (isPrepared()) {
+    return;
+  }
+  spool = std::make_shared<const SpoolGeometry>(wireThickness, innerRadius,
+                                                totalWireLength);
+  preparedWireThickness = wireThickness;
+  preparedInnerRadius = innerRadius;
+  preparedTotalWireLength = totalWireLength;
+  preparedStartPosition = startPosition;
+  startSpoolRotation = spool->rotationAtPosition(startPosition);
+}
+
+bool MotionTrajectory::isPrepared() const {
+  return spool && preparedWireThickness == wireThickness &&
+         preparedInnerRadius == innerRadius &&
+         preparedTotalWireLength == totalWireLength &&
+         preparedStartPosition == startPosition;
+}
@@ -0,0 +1,139 @@
+#include "MotorDynamics.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / 3.14159265358979323846;
+} // namespace
+
+MotorDynamicsBank::MotorDynamicsBank(const MotorDynamicsParams &params)
+    : params(params) {}
+
+size_t MotorDynamicsBank::addAxis(double initialRotation) {
+  angle.push_back(initialRotation * DEG_TO_RAD);
+  velocity.push_back(0.0);
+  integral.push_back(0.0);
+  lastSetpoint.push_back(initialRotation * DEG_TO_RAD);
+  torque.push_back(0.0);
+  maxAbsError.push_back(0.0);
+  sumSquaredErr.push_back(0.0);
+  errorSamples.push_back(0);
+  return angle.size() - 1;
+}
+
+size_t MotorDynamicsBank::size() const { return angle.size(); }
+
+void MotorDynamicsBank::resetAxis(size_t axis, double rotation) {
+  angle[axis] = rotation * DEG_TO_RAD;
+  velocity[axis] = 0.0;
+  integral[axis] = 0.0;
+  lastSetpoint[axis] = rotation * DEG_TO_RAD;
+  torque[axis] = 0.0;
+  maxAbsError[axis] = 0.0;
+  sumSquaredErr[axis] = 0.0;
+  errorSamples[axis] = 0;
+}
+
+void MotorDynamicsBank::advance(const double *setpoints, double period) {
+  // 도 → 라디안 변환 후 전체 축을 한 번에 적분
+  scratchTargets.resize(size());
+  for (size_t i = 0; i < scratchTargets.size(); ++i) {
+    scratchTargets[i] = setpoints[i] * DEG_TO_RAD;
+  }
+  integrate(0, size(), scratchTargets.data(), period);
+}
+
+void MotorDynamicsBank::advanceAxis(size_t axis, double setpoint,
+                                    double period) {
+  double target = setpoint * DEG_TO_RAD;
+  integrate(axis, axis + 1, &target, period);
+}
+
+void MotorDynamicsBank::integrate(size_t begin, size_t end,
+                                  const double *targets, double period) {
+  const size_t count = end - begin;
+  const int substeps = std::max(1, params.substeps);
+  const double h = period / substeps;
+  const double baseInertia = params.motorInertia + params.spoolInertia;
+  const double turnsPerRad = 1.0 / (2.0 * 3.14159265358979323846);
+  const double maxTorque = params.maxTorque;
+
+  double *theta = angle.data() + begin;
+  double *omega = velocity.data() + begin;
+  double *errInt = integral.data() + begin;
+  double *prevSp = lastSetpoint.data() + begin;
+  double *tau = torque.data() + begin;
+
+  // 서브스텝 바깥, 축 안쪽 루프: 축 방향 연속 배열을 분기 없이 순회
+  for (int s = 1; s <= substeps; ++s) {
+    const double fraction = static_cast<double>(s) / substeps;
+    for (size_t i = 0; i < count; ++i) {
+      // 목표값 선형 보간
+      double delta = targets[i] - prevSp[i];
+      double sp = prevSp[i] + delta * fraction;
+      double error = sp - theta[i];
+
+      // 감긴 와이어 양에 따른 관성
+      double wound = params.fullyWoundTurns - theta[i] * turnsPerRad;
+      double inertia =
+          baseInertia + params.wireInertiaPerTurn * std::max(0.0, wound);
+
+      // PID (속도 오차 기반 미분항) + 토크 포화
+      double command = params.kp * error + params.ki * errInt[i] +
+                       params.kd * (delta / period - omega[i]);
+      double limited = std::min(maxTorque, std::max(-maxTorque, command));
+
+      // 포화 중에는 적분 중단 (anti-windup)
+      errInt[i] += (limited == command) ? error * h : 0.0;
+
+      // 반암시적 오일러 적분
+      omega[i] += (limited / inertia) * h;
+      theta[i] += omega[i] * h;
+      tau[i] = limited;
+    }
+  }
+
+  // 제어 주기 끝의 추종 오차 집계
+  for (size_t i = 0; i < count; ++i) {
+    prevSp[i] = targets[i];
+    double followingError = targets[i] - theta[i];
+    maxAbsError[begin + i] =
+        std::max(maxAbsError[begin + i], std::abs(followingError));
+    sumSquaredErr[begin + i] += followingError * followingError;
+    errorSamples[begin + i]++;
+  }
+}
+
+double MotorDynamicsBank::getRotation(size_t axis) const {
+  return angle[axis] * RAD_TO_DEG;
+}
+
+double MotorDynamicsBank::getVelocity(size_t axis) const {
+  return velocity[axis] * RAD_TO_DEG;
+}
+
+double MotorDynamicsBank::getTorque(size_t axis) const { return torque[axis]; }
+
+double MotorDynamicsBank::getInertia(size_t axis) const {
+  double wound =
+      params.fullyWoundTurns - angle[axis] / (2.0 * 3.14159265358979323846);
+  return params.motorInertia + params.spoolInertia +
+         params.wireInertiaPerTurn * std::max(0.0, wound);
+}
+
+FollowingErrorStats
+MotorDynamicsBank::getFollowingErrorStats(size_t axis) const {
+  FollowingErrorStats stats;
+  stats.samples = errorSamples[axis];
+  stats.maxAbsError = maxAbsError[axis] * RAD_TO_DEG;
+  if (stats.samples > 0) {
+    stats.rmsError =
+        std::sqrt(sumSquaredErr[axis] / stats.samples) * RAD_TO_DEG;
+  }
+  return stats;
+}
+
+const MotorDynamicsParams &MotorDynamicsBank::getParams() const {
+  return params;
+}
@@ -0,0 +1,175 @@
+#include "MoveScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+std::coroutine_handle<> MoveTask::promise_type::FinalAwaiter::await_suspend(
+    std::coroutine_handle<promise_type> handle) noexcept {
+  promise_type &promise = handle.promise();
+  if (promise.continuation) {
+    return promise.continuation; // 하위 시퀀스 종료: 상위 코루틴 재개
+  }
+  if (promise.scheduler != nullptr) {
+    promise.scheduler->onTaskFinished(handle);
+  }
+  return std::noop_coroutine();
+}
+
+MoveTask::MoveTask(MoveTask &&other) noexcept
+    : handle(std::exchange(other.handle, nullptr)) {}
+
+MoveTask &MoveTask::operator=(MoveTask &&other) noexcept {
+  if (this != &other) {
+    if (handle) {
+      handle.destroy();
+    }
+    handle = std::exchange(other.handle, nullptr);
+  }
+  return *this;
+}
+
+MoveTask::~MoveTask() {
+  if (handle) {
+    handle.destroy();
+  }
+}
+
+std::coroutine_handle<>
+MoveTask::await_suspend(std::coroutine_handle<> awaiting) {
+  handle.promise().continuation = awaiting;
+  return handle;
+}
+
+void MoveTask::await_resume() {
+  if (handle && handle.promise().exception) {
+    std::rethrow_exception(handle.promise().exception);
+  }
+}
+
+MoveScheduler::MoveScheduler(double controlPeriod,
+                             std::function<void()> advanceClock)
+    : controlPeriod(controlPeriod), advanceClock(std::move(advanceClock)),
+      tick(0), resumeCount(0), activeTasks(0) {}
+
+MoveScheduler::~MoveScheduler() {
+  // 대기 중인 하위 시퀀스 프레임은 상위 MoveTask가 해제
+  for (auto handle : tasks) {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+}
+
+void MoveScheduler::spawn(MoveTask task) {
+  auto handle = std::exchange(task.handle, nullptr);
+  if (!handle) {
+    return;
+  }
+  handle.promise().scheduler = this;
+  handle.promise().slot = tasks.size();
+  tasks.push_back(handle);
+  activeTasks++;
+
+  resumeCount++;
+  handle.resume();
+  releaseFinished();
+}
+
+size_t MoveScheduler::step() {
+  advanceClock();
+  tick++;
+
+  // 깨울 코루틴 수집 (남은 항목과 재개 순서 모두 등록 순서 유지)
+  size_t kept = 0;
+  for (size_t i = 0; i < waiting.size(); i++) {
+    const Waiter &waiter = waiting[i];
+    bool wake = waiter.motor != nullptr ? !waiter.motor->isRunning()
+                                        : tick >= waiter.wakeTick;
+    if (wake) {
+      ready.push_back(waiter.handle);
+    } else {
+      waiting[kept++] = waiter;
+    }
+  }
+  waiting.resize(kept);
+
+  // 재개 중 새로 등록되는 대기 항목은 다음 주기부터 검사
+  size_t resumed = ready.size();
+  for (size_t i = 0; i < ready.size(); i++) {
+    ready[i].resume();
+  }
+  ready.clear();
+  resumeCount += resumed;
+
+  releaseFinished();
+  return resumed;
+}
+
+size_t MoveScheduler::runUntilIdle(size_t maxTicks) {
+  size_t ticks = 0;
+  while (!waiting.empty() && ticks < maxTicks) {
+    step();
+    ticks++;
+  }
+  return ticks;
+}
+
+MoveScheduler::MotorAwaiter MoveScheduler::waitForMotor(Motor &motor) {
+  return MotorAwaiter{*this, motor};
+}
+
+MoveScheduler::DelayAwaiter MoveScheduler::delay(double seconds) {
+  double ticks = std::round(std::max(0.0, seconds) / controlPeriod);
+  return DelayAwaiter{*this, static_cast<uint64_t>(ticks)};
+}
+
+void MoveScheduler::MotorAwaiter::await_suspend(
+    std::coroutine_handle<> handle) {
+  scheduler.waiting.push_back({handle, &motor, 0});
+}
+
+void MoveScheduler::DelayAwaiter::await_suspend(
+    std::coroutine_handle<> handle) {
+  scheduler.waiting.push_back({handle, nullptr, scheduler.tick + ticks});
+}
+
+size_t MoveScheduler::getActiveTaskCount() const { return activeTasks; }
+
+size_t MoveScheduler::getWaitingCount() const { return waiting.size(); }
+
+uint64_t MoveScheduler::getTick() const { return tick; }
+
+double MoveScheduler::getElapsedTime() const { return tick * controlPeriod; }
+
+uint64_t MoveScheduler::getResumeCount() const { return resumeCount; }
+
+double MoveScheduler::getControlPeriod() const { return controlPeriod; }
+
+void MoveScheduler::onTaskFinished(
+    std::coroutine_handle<MoveTask::promise_type> handle) {
+  finished.push_back(handle);
+}
+
+void MoveScheduler::releaseFinished() {
+  if (finished.empty()) {
+    return;
+  }
+  for (auto handle : finished) {
+    if (handle.promise().exception && !pendingException) {
+      pendingException = handle.promise().exception;
+    }
+    // 소유 목록에서 마지막 항목과 교체하여 제거
+    size_t slot = handle.promise().slot;
+    tasks[slot] = tasks.back();
+    tasks[slot].promise().slot = slot;
+    tasks.pop_back();
+    handle.destroy();
+    activeTasks--;
+  }
+  finished.clear();
+
+  // 최상위 작업의 예외는 spawn()/step() 호출 측으로 전파
+  if (pendingException) {
+    std::rethrow_exception(std::exchange(pendingException, nullptr));
+  }
+}
@@ -0,0 +1,92 @@
+#include "OnlineCalibrator.h"
+#include "RollWireCalculator.h"
+#include <cmath>
+
+namespace {
+const double PI = 3.14159265358979323846;
+} // namespace
+
+OnlineCalibrator::OnlineCalibrator(double wireThickness, double innerRadius,
+                                   double totalWireLength,
+                                   double forgettingFactor, double priorWeight)
+    : forgettingFactor(forgettingFactor), totalWireLength(totalWireLength),
+      samples(0) {
+  // 공칭 형상의 계수에서 시작 (모두 감긴 상태의 반지름 = 내경 + N × 두께)
+  RollWireCalculator calculator(wireThickness, innerRadius);
+  double woundTurns =
+      calculator.calculateRotationFromLength(totalWireLength) / 360.0;
+  double outerRadius = innerRadius + woundTurns * wireThickness;
+  outerCoefficient = 2.0 * PI * outerRadius / 1000.0;
+  wireCoefficient = PI * wireThickness / 1000.0;
+
+  covariance[0][0] = 1.0 / priorWeight;
+  covariance[0][1] = 0.0;
+  covariance[1][0] = 0.0;
+  covariance[1][1] = 1.0 / priorWeight;
+
+  estimate.store(Estimate{wireThickness, innerRadius, 0.0, 0});
+}
+
+bool OnlineCalibrator::addSample(double position, double rotation) {
+  if (!std::isfinite(position) || !std::isfinite(rotation) || rotation < 0.0) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(updateMutex);
+  // 회귀 벡터 h = [m, -m²], 관측 y = s
+  double m = rotation / 360.0;
+  double h0 = m;
+  double h1 = -m * m;
+  double residual = position - (outerCoefficient * h0 + wireCoefficient * h1);
+
+  // 이득 k = P·h / (λ + hᵀ·P·h)
+  double ph0 = covariance[0][0] * h0 + covariance[0][1] * h1;
+  double ph1 = covariance[1][0] * h0 + covariance[1][1] * h1;
+  double denominator = forgettingFactor + h0 * ph0 + h1 * ph1;
+  double k0 = ph0 / denominator;
+  double k1 = ph1 / denominator;
+
+  outerCoefficient += k0 * residual;
+  wireCoefficient += k1 * residual;
+
+  // P = (P - k·(P·h)ᵀ) / λ
+  covariance[0][0] = (covariance[0][0] - k0 * ph0) / forgettingFactor;
+  covariance[0][1] = (covariance[0][1] - k0 * ph1) / forgettingFactor;
+  covariance[1][0] = (covariance[1][0] - k1 * ph0) / forgettingFactor;
+  covariance[1][1] = (covariance[1][1] - k1 * ph1) / forgettingFactor;
+  samples++;
+
+  double wireThickness;
+  double innerRadius;
+  if (!toGeometry(wireThickness, innerRadius)) {
+    return false; // 표본이 부족하거나 잡음으로 불가능한 형상 (이전 값 유지)
+  }
+  estimate.store(Estimate{wireThickness, innerRadius, residual, samples});
+  return true;
+}
+
+OnlineCalibrator::Estimate OnlineCalibrator::getEstimate() const {
+  return estimate.load();
+}
+
+uint64_t OnlineCalibrator::getVersion() const { return estimate.version(); }
+
+bool OnlineCalibrator::toGeometry(double &wireThickness,
+                                  double &innerRadius) const {
+  double a = outerCoefficient;
+  double beta = wireCoefficient;
+  if (!(a > 0.0) || !(beta > 0.0)) {
+    return false;
+  }
+
+  // 전체 길이 L = a·N - β·N² 의 작은 근이 감긴 회전수 N
+  double discriminant = a * a - 4.0 * beta * totalWireLength;
+  if (discriminant < 0.0) {
+    return false;
+  }
+  double woundTurns = 2.0 * totalWireLength / (a + std::sqrt(discriminant));
+
+  wireThickness = beta * 1000.0 / PI;
+  innerRadius = a * 1000.0 / (2.0 * PI) - woundTurns * wireThickness;
+  return innerRadius > 0.0;
+}
@@ -0,0 +1,267 @@
+#include "PlantSimulator.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <queue>
+#include <random>
+#include <thread>
+
+namespace {
+
+// 대기열 항목: 같은 시각이면 등록(재배치) 순서대로 처리
+struct QueuedEvent {
+  double time;
+  size_t sequence;
+  PlantEvent event;
+};
+
+struct LaterFirst {
+  bool operator()(const QueuedEvent &a, const QueuedEvent &b) const {
+    if (a.time != b.time) {
+      return a.time > b.time;
+    }
+    return a.sequence > b.sequence;
+  }
+};
+
+} // namespace
+
+PlantSimulator::PlantSimulator(const Config &config, ErrorCode &outError)
+    : config(config) {
+  if (config.axisCount == 0) {
+    outError = ErrorCode::INVALID_AXIS_COUNT;
+    return;
+  }
+  if (config.wireThickness <= 0.0 || config.innerRadius <= 0.0 ||
+      config.maxWireLength <= 0.0 || config.constantVelocity <= 0.0 ||
+      config.controlPeriod <= 0.0) {
+    outError = ErrorCode::INVALID_PARAMETER;
+    return;
+  }
+
+  // 축 이동기가 받아들이지 않는 값(속도/주기/길이 범위)은 여기서 거부
+  // (simulateAxis에서 설정이 무시된 채 기본값으로 실행되지 않도록)
+  RollWireMover::MotionSettings settings;
+  settings.maxWireLength = config.maxWireLength;
+  settings.constantVelocity = config.constantVelocity;
+  settings.controlPeriod = config.controlPeriod;
+  RollWireMover::ErrorCode moverError;
+  if (!RollWireMover::MotionConfig::create(settings, config.wireThickness,
+                                           config.innerRadius, moverError)) {
+    outError = ErrorCode::INVALID_PARAMETER;
+    return;
+  }
+
+  axisEvents.resize(config.axisCount);
+  outError = ErrorCode::SUCCESS;
+}
+
+PlantSimulator::ErrorCode PlantSimulator::schedule(const PlantEvent &event) {
+  if (event.axis >= axisEvents.size()) {
+    return ErrorCode::INVALID_AXIS;
+  }
+  if (!(event.time >= 0.0)) {
+    return ErrorCode::INVALID_TIME;
+  }
+  axisEvents[event.axis].push_back(event);
+  return ErrorCode::SUCCESS;
+}
+
+PlantSimulator::ErrorCode
+PlantSimulator::scheduleShift(double duration, double meanInterval,
+                              uint64_t seed) {
+  if (!(duration > 0.0) || !(meanInterval > 0.0)) {
+    return ErrorCode::INVALID_PARAMETER;
+  }
+
+  for (size_t axis = 0; axis < axisEvents.size(); ++axis) {
+    // 축별 독립 난수열: 축 수나 스레드 수가 바뀌어도 같은 축은 같은 스케줄
+    std::seed_seq seq{static_cast<uint32_t>(seed),
+                      static_cast<uint32_t>(seed >> 32),
+                      static_cast<uint32_t>(axis)};
+    std::mt19937_64 rng(seq);
+    std::exponential_distribution<double> interval(1.0 / meanInterval);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    double time = 0.0;
+    while (true) {
+      time += interval(rng);
+      if (time > duration) {
+        break;
+      }
+
+      PlantEvent event;
+      event.time = time;
+      event.axis = axis;
+      double kind = unit(rng);
+      if (kind < 0.90) {
+        event.type = PlantEvent::Type::MOVE_TO;
+        event.value = unit(rng) * config.maxWireLength;
+      } else if (kind < 0.95) {
+        event.type = PlantEvent::Type::STOP;
+      } else {
+        event.type = PlantEvent::Type::SET_INNER_RADIUS;
+        event.value = config.innerRadius * (0.8 + 0.4 * unit(rng));
+      }
+      axisEvents[axis].push_back(event);
+    }
+  }
+  return ErrorCode::SUCCESS;
+}
+
+size_t PlantSimulator::getScheduledEventCount() const {
+  size_t count = 0;
+  for (const auto &events : axisEvents) {
+    count += events.size();
+  }
+  return count;
+}
+
+void PlantSimulator::clear() {
+  for (auto &events : axisEvents) {
+    events.clear();
+  }
+}
+
+PlantReport PlantSimulator::run() const {
+  PlantReport report;
+  report.axes.resize(axisEvents.size());
+
+  // 스레드 풀: 각 작업자가 다음 축 번호를 가져가 처리
+  size_t threadCount = config.threadCount;
+  if (threadCount == 0) {
+    threadCount = std::max(1u, std::thread::hardware_concurrency());
+  }
+  threadCount = std::min(threadCount, axisEvents.size());
+
+  std::atomic<size_t> nextAxis(0);
+  auto worker = [&]() {
+    for (size_t axis = nextAxis++; axis < axisEvents.size();
+         axis = nextAxis++) {
+      report.axes[axis] = simulateAxis(axisEvents[axis]);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < threadCount; ++i) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : workers) {
+    thread.join();
+  }
+
+  // 집계 (축 순서대로 합산하여 결정적 결과 보장)
+  for (const auto &axis : report.axes) {
+    report.totalEvents += axis.eventsProcessed;
+    report.totalMoves += axis.movesCompleted + axis.movesStopped;
+    report.cycleTime = std::max(report.cycleTime, axis.finishTime);
+  }
+  if (report.cycleTime > 0.0) {
+    for (auto &axis : report.axes) {
+      axis.utilization = axis.busyTime / report.cycleTime;
+    }
+    report.movesPerSecond = report.totalMoves / report.cycleTime;
+  }
+  return report;
+}
+
+AxisReport
+PlantSimulator::simulateAxis(const std::vector<PlantEvent> &events) const {
+  AxisReport axisReport;
+
+  SimMotor motor;
+  motor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  motor.setTimeWarp(true);
+
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(config.wireThickness, config.innerRadius, &motor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.setMaxWireLength(config.maxWireLength);
+  mover.setConstantVelocity(config.constantVelocity);
+  mover.setControlPeriod(config.controlPeriod);
+
+  std::priority_queue<QueuedEvent, std::vector<QueuedEvent>, LaterFirst>
+      queue;
+  size_t sequence = 0;
+  for (const auto &event : events) {
+    queue.push({event.time, sequence++, event});
+  }
+
+  // 진행 중인 이동 상태 (시뮬레이션 시각 ↔ 모터 누적 시간 대응)
+  bool moving = false;
+  double moveStart = 0.0;
+  double moveEnd = 0.0;
+  double motorStartTime = 0.0;
+
+  // time 시각까지 모터 진행, 이동이 끝났으면 완료 처리
+  auto advanceTo = [&](double time) {
+    if (!moving) {
+      return;
+    }
+    if (time >= moveEnd) {
+      motor.stepN(std::numeric_limits<size_t>::max());
+    } else {
+      motor.runUntil(motorStartTime + (time - moveStart));
+    }
+    if (!motor.isRunning()) {
+      moving = false;
+      axisReport.busyTime += moveEnd - moveStart;
+      axisReport.movesCompleted++;
+    }
+  };
+
+  double lastTime = 0.0;
+  while (!queue.empty()) {
+    QueuedEvent queued = queue.top();
+    queue.pop();
+    const PlantEvent &event = queued.event;
+
+    advanceTo(queued.time);
+    lastTime = queued.time;
+
+    // 이동 중에는 STOP 외의 명령을 이동 완료 시각으로 미룸
+    if (moving && event.type != PlantEvent::Type::STOP) {
+      queue.push({moveEnd, sequence++, event});
+      axisReport.deferredEvents++;
+      continue;
+    }
+
+    axisReport.eventsProcessed++;
+    switch (event.type) {
+    case PlantEvent::Type::MOVE_TO:
+      if (mover.moveTo(event.value) != RollWireMover::ErrorCode::SUCCESS) {
+        axisReport.movesRejected++;
+      } else if (motor.isRunning()) {
+        moving = true;
+        moveStart = queued.time;
+        moveEnd = moveStart + mover.getLastTrajectory().duration();
+        motorStartTime = motor.getElapsedTime();
+      }
+      break;
+    case PlantEvent::Type::STOP:
+      if (moving) {
+        mover.stop();
+        moving = false;
+        axisReport.busyTime += queued.time - moveStart;
+        axisReport.movesStopped++;
+      }
+      break;
+    case PlantEvent::Type::SET_INNER_RADIUS:
+      mover.setInnerRadius(event.value);
+      break;
+    }
+  }
+
+  // 마지막 이동 완료까지 진행
+  if (moving) {
+    lastTime = std::max(lastTime, moveEnd);
+    advanceTo(moveEnd);
+  }
+
+  axisReport.finishTime = lastTime;
+  axisReport.finalPosition = mover.getCurrentPosition();
+  return axisReport;
+}
@@ -1,233 +1,1355 @@
 #include "RollWireMover.h"
-#include "RollWireCalculator.h"
+#include "AllocationTracker.h"
+#include "MotionTrace.h"
+#include "OnlineCalibrator.h"
+#include "SpoolGeometry.h"
+#include "SpoolSnapshot.h"
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <utility>
 #include <vector>
 
+// 속도 프로파일 기록 기본 모드 (OFF, LAST, HISTORY 중 하나)
+#ifndef ROLLWIREMOVER_PROFILE_CAPTURE_DEFAULT
+#define ROLLWIREMOVER_PROFILE_CAPTURE_DEFAULT LAST
+#endif
+
 RollWireMover::RollWireMover(double wireThickness, double innerRadius,
                              Motor *motor, ErrorCode &outError)
-    : calculator(nullptr), motor(motor),
+    : motor(motor),
       currentPosition(0.0),               // 초기 위치는 0 (완전히 올린 상태)
       currentState(MotionState::STOPPED), // 초기 상태는 STOPPED
-      maxWireLength(5.0),                 // 초기 최대 와이어 길이는 5.0m
-      innerRadius(innerRadius),           // 롤 내경 반지름 저장
-      currentProfile(ProfileType::TRAPEZOID) { // 기본 프로파일은 TRAPEZOID
+      moveStartPosition(0.0), moveStartRotation(0.0),
+      constructionError(ErrorCode::SUCCESS),
+      planWorkerExit(false), motionSequence(0), commandedEndRotation(0.0),
+      appliedCalibrationVersion(0), snapshotDurable(true),
+      profileCapture(
+          ProfileCaptureMode::ROLLWIREMOVER_PROFILE_CAPTURE_DEFAULT),
+      profileHistoryNext(0), profileHistoryCount(0), profileMaxSamples(0) {
+
+  publishStatus();
 
+  // 검증에 실패하면 설정을 게시하지 않고, 설정 메서드는 이 에러를 반환
   // Motor 포인터 검증
   if (motor == nullptr) {
-    outError = ErrorCode::INVALID_MOTOR_POINTER;
+    outError = constructionError = ErrorCode::INVALID_MOTOR_POINTER;
     return;
   }
 
   // wireThickness 검증
   if (wireThickness <= 0.0) {
-    outError = ErrorCode::INVALID_WIRE_THICKNESS;
+    outError = constructionError = ErrorCode::INVALID_WIRE_THICKNESS;
     return;
   }
 
   // innerRadius 검증
   if (innerRadius <= 0.0) {
-    outError = ErrorCode::INVALID_INNER_RADIUS;
+    outError = constructionError = ErrorCode::INVALID_INNER_RADIUS;
     return;
   }
 
-  // Calculator 생성
-  calculator = new RollWireCalculator(wireThickness, innerRadius);
+  moveStartRotation = motor->getCurrentRotation();
+  commandedEndRotation = moveStartRotation;
 
-  outError = ErrorCode::SUCCESS;
+  // 기본 모션 설정 게시 (기본값은 MotionSettings 참고)
+  publishParameters(MotionConfig::create(MotionSettings(), wireThickness,
+                                         innerRadius, outError));
+  constructionError = outError;
 }
 
 RollWireMover::~RollWireMover() {
-  if (calculator != nullptr) {
-    delete calculator;
-    calculator = nullptr;
+  // 계획 스레드 종료 (진행 중인 계획은 끝까지 수행)
+  {
+    std::lock_guard<std::mutex> lock(planMutex);
+    planWorkerExit = true;
+  }
+  planCondition.notify_one();
+  if (planWorker.joinable()) {
+    planWorker.join();
   }
 }
 
-double RollWireMover::getCurrentPosition() const { return currentPosition; }
+RollWireMover::Status RollWireMover::getStatus() const { return status.load(); }
+
+double RollWireMover::getCurrentPosition() const {
+  return status.load().position;
+}
 
 RollWireMover::MotionState RollWireMover::getCurrentState() const {
-  return currentState;
+  return status.load().state;
 }
 
 bool RollWireMover::isMoving() const {
-  return currentState != MotionState::STOPPED;
+  return getCurrentState() != MotionState::STOPPED;
 }
 
-RollWireMover::ErrorCode RollWireMover::setAccelerationTime(double time) {
-  if (time <= 0.0) {
-    return ErrorCode::INVALID_ACCELERATION_TIME;
+std::shared_ptr<const RollWireMover::MotionConfig>
+RollWireMover::getMotionConfig() const {
+  return currentParameters();
+}
+
+std::shared_ptr<const RollWireMover::MotionConfig>
+RollWireMover::makeMotionConfig(const MotionSettings &settings,
+                                ErrorCode &outError) const {
+  std::shared_ptr<const MotionConfig> current = currentParameters();
+  if (!current) {
+    outError = constructionError;
+    return nullptr;
   }
-  accelerationTime = time;
-  return ErrorCode::SUCCESS;
+  return MotionConfig::create(settings, current->wireThickness,
+                              current->innerRadius, outError);
 }
 
-RollWireMover::ErrorCode RollWireMover::setConstantVelocity(double velocity) {
-  if (velocity < MIN_VELOCITY || velocity > MAX_VELOCITY) {
-    return ErrorCode::INVALID_VELOCITY;
+RollWireMover::ErrorCode
+RollWireMover::setMotionConfig(std::shared_ptr<const MotionConfig> config) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  std::shared_ptr<const MotionConfig> current = currentParameters();
+  if (!current) {
+    return constructionError;
+  }
+  if (!config || !config->hasSameSpool(*current)) {
+    return ErrorCode::INVALID_MOTION_CONFIG;
+  }
+  if (config->controlPeriod != current->controlPeriod) {
+    motor->setControlPeriod(config->controlPeriod);
   }
-  constantVelocity = velocity;
+  publishParameters(std::move(config));
   return ErrorCode::SUCCESS;
 }
 
+RollWireMover::ErrorCode RollWireMover::setAccelerationTime(double time) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.accelerationTime = time;
+  return publishSettings(next);
+}
+
+RollWireMover::ErrorCode RollWireMover::setConstantVelocity(double velocity) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.constantVelocity = velocity;
+  return publishSettings(next);
+}
+
 RollWireMover::ErrorCode RollWireMover::setDecelerationTime(double time) {
-  if (time <= 0.0) {
-    return ErrorCode::INVALID_DECELERATION_TIME;
-  }
-  decelerationTime = time;
-  return ErrorCode::SUCCESS;
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.decelerationTime = time;
+  return publishSettings(next);
 }
 
 RollWireMover::ErrorCode RollWireMover::setMaxWireLength(double length) {
   if (length <= 0.0) {
     return ErrorCode::INVALID_MAX_LENGTH;
   }
-  maxWireLength = length;
-  return ErrorCode::SUCCESS;
+  std::lock_guard<std::mutex> lock(commandMutex);
+  if (currentParameters() && motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY; // 이동 중 스풀 모델(최대 길이) 교체 불가
+  }
+  MotionSettings next = currentSettings();
+  next.maxWireLength = length;
+  return publishSettings(next);
 }
 
 RollWireMover::ErrorCode RollWireMover::setInnerRadius(double radius) {
   if (radius <= 0.0) {
     return ErrorCode::INVALID_INNER_RADIUS;
   }
-  innerRadius = radius;
+  std::lock_guard<std::mutex> lock(commandMutex);
+  if (!currentParameters()) {
+    return constructionError;
+  }
+  if (motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY; // 이동 중 스풀 교체 불가
+  }
+
+  // 계산기와 형상 의존 캐시(스풀 변환)만 교체, 램프 상수는 재사용
+  applyGeometry(currentParameters()->withInnerRadius(radius));
+  snapshotIfIdle();
   return ErrorCode::SUCCESS;
 }
 
+double RollWireMover::getInnerRadius() const {
+  std::shared_ptr<const MotionConfig> current = currentParameters();
+  return current ? current->innerRadius : 0.0;
+}
+
+RollWireMover::ErrorCode RollWireMover::setControlPeriod(double period) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.controlPeriod = period;
+  ErrorCode result = publishSettings(next);
+  if (result == ErrorCode::SUCCESS) {
+    // 모터도 같은 주기로 회전량 배열을 실행하도록 전달
+    motor->setControlPeriod(period);
+  }
+  return result;
+}
+
+double RollWireMover::getControlPeriod() const {
+  return currentSettings().controlPeriod;
+}
+
+RollWireMover::ErrorCode
+RollWireMover::setMotorLimits(double maxRpm, double maxAngularAcceleration) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.maxMotorRpm = maxRpm;
+  next.maxAngularAcceleration = maxAngularAcceleration;
+  return publishSettings(next);
+}
+
+void RollWireMover::setPlanningSpace(PlanningSpace space) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.planningSpace = space;
+  publishSettings(next);
+}
+
+RollWireMover::PlanningSpace RollWireMover::getPlanningSpace() const {
+  return currentSettings().planningSpace;
+}
+
+RollWireMover::ErrorCode RollWireMover::setConstantRpm(double rpm) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  if (rpm > next.maxMotorRpm) {
+    return ErrorCode::INVALID_VELOCITY;
+  }
+  next.constantRpm = rpm;
+  return publishSettings(next);
+}
+
+double RollWireMover::getConstantRpm() const {
+  return currentSettings().constantRpm;
+}
+
+double RollWireMover::getMaxMotorRpm() const {
+  return currentSettings().maxMotorRpm;
+}
+
+double RollWireMover::getMaxAngularAcceleration() const {
+  return currentSettings().maxAngularAcceleration;
+}
+
 void RollWireMover::setVelocityProfile(ProfileType type) {
-  currentProfile = type;
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.profile = type;
+  publishSettings(next);
+}
+
+void RollWireMover::setQuantizationMode(QuantizationMode mode) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.quantizationMode = mode;
+  publishSettings(next);
+}
+
+RollWireMover::QuantizationMode RollWireMover::getQuantizationMode() const {
+  return currentSettings().quantizationMode;
+}
+
+void RollWireMover::setTrajectoryMode(TrajectoryMode mode) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  MotionSettings next = currentSettings();
+  next.trajectoryMode = mode;
+  publishSettings(next);
+}
+
+RollWireMover::TrajectoryMode RollWireMover::getTrajectoryMode() const {
+  return currentSettings().trajectoryMode;
 }
 
 RollWireMover::ErrorCode RollWireMover::moveTo(double targetPosition) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  applyCalibrationIfUpdated();
+  std::shared_ptr<const MotionConfig> config = currentParameters();
+  return moveToLocked(targetPosition, *config);
+}
+
+RollWireMover::ErrorCode RollWireMover::moveTo(double targetPosition,
+                                               const MotionConfig &config) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  // 모터 주기와 위치 ↔ 회전량 변환이 현재 설정과 일치해야 함
+  std::shared_ptr<const MotionConfig> current = currentParameters();
+  if (config.controlPeriod != current->controlPeriod ||
+      !config.hasSameSpool(*current)) {
+    return ErrorCode::INVALID_MOTION_CONFIG;
+  }
+  return moveToLocked(targetPosition, config);
+}
+
+RollWireMover::ErrorCode RollWireMover::moveRelative(double distance) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  applyCalibrationIfUpdated();
+  std::shared_ptr<const MotionConfig> config = currentParameters();
+  return moveToLocked(currentPosition + distance, *config);
+}
+
+RollWireMover::ErrorCode RollWireMover::moveToLocked(double targetPosition,
+                                                     const MotionConfig &p) {
   // 목표 위치 검증
-  if (targetPosition < 0.0 || targetPosition > maxWireLength) {
+  if (targetPosition < 0.0 || targetPosition > p.maxWireLength) {
     return ErrorCode::OUT_OF_RANGE;
   }
 
-  // 이동 거리 계산
-  double distance = targetPosition - currentPosition;
+  // 실행 중이면 모터 회전량과 currentPosition(이전 목표)이 대응하지 않음
+  if (motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY;
+  }
 
   // 이동 거리가 0이면 바로 성공
-  if (std::abs(distance) < 0.000001) {
+  if (std::abs(targetPosition - currentPosition) < 0.000001) {
     return ErrorCode::SUCCESS;
   }
 
+  MotionTraceScope trace("moveTo", "mover");
+  AllocationMark allocationMark = beginMoveAllocations();
+  PlannedMotion plan;
+  planMotion(p, currentPosition, motor->getCurrentRotation(), targetPosition,
+             plan);
+  startMotion(plan);
+  endMoveAllocations(allocationMark);
+  return ErrorCode::SUCCESS;
+}
+
+void RollWireMover::stop() {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  motor->stop();
+
+  // 이동 시작 이후 모터 회전량 변화로 실제 위치 역산
+  std::shared_ptr<const MotionConfig> config = currentParameters();
+  const SpoolGeometry &spool = config->getSpool();
+  double startRotation = spool.rotationAtPosition(moveStartPosition);
+  currentPosition = spool.positionAtRotation(
+      startRotation + motor->getCurrentRotation() - moveStartRotation);
+  currentState = MotionState::STOPPED;
+
+  // 연속 호출 시 위치가 변하지 않도록 기준 갱신
+  moveStartPosition = currentPosition;
+  moveStartRotation = motor->getCurrentRotation();
+  commandedEndRotation = moveStartRotation;
+  motionSequence++;
+  publishStatus();
+  snapshotIfIdle();
+  MotionTrace::instant("stop", "mover", currentPosition);
+}
+
+std::shared_future<RollWireMover::ErrorCode>
+RollWireMover::planMove(double targetPosition) {
+  std::lock_guard<std::mutex> commandLock(commandMutex);
+  applyCalibrationIfUpdated();
+  std::shared_ptr<const MotionConfig> config = currentParameters();
+  if (targetPosition < 0.0 || targetPosition > config->maxWireLength) {
+    std::promise<ErrorCode> rejected;
+    rejected.set_value(ErrorCode::OUT_OF_RANGE);
+    return rejected.get_future().share();
+  }
+
+  // 뒤 버퍼는 하나이므로 진행 중인 이전 계획은 끝난 뒤 버림
+  if (pendingFuture.valid()) {
+    pendingFuture.wait();
+  }
+  if (!pendingPlan) {
+    pendingPlan.reset(new PlannedMotion());
+  }
+  pendingPlan->sequence = motionSequence;
+
+  // 실행 중이면 현재 이동이 끝나는 지점에서 시작하도록 계획
+  std::unique_ptr<PlanRequest> request(new PlanRequest());
+  request->config = config;
+  request->startPosition = currentPosition;
+  request->startRotation = motor->isRunning() ? commandedEndRotation
+                                              : motor->getCurrentRotation();
+  request->targetPosition = targetPosition;
+  request->buffer = pendingPlan.get();
+  pendingFuture = request->promise.get_future().share();
+
+  std::lock_guard<std::mutex> lock(planMutex);
+  planningStats.plansRequested++;
+  if (!planWorker.joinable()) {
+    planWorker = std::thread(&RollWireMover::planWorkerLoop, this);
+  }
+  planRequest = std::move(request);
+  planCondition.notify_one();
+  return pendingFuture;
+}
+
+RollWireMover::ErrorCode RollWireMover::executePlannedMove() {
+  std::lock_guard<std::mutex> commandLock(commandMutex);
+  if (!pendingFuture.valid()) {
+    return ErrorCode::NO_PLANNED_MOVE;
+  }
+  if (motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY;
+  }
+
+  // 필요한 시점에 계획이 이미 끝나 있었는지 기록 후 완료 대기
+  MotionTraceScope trace("executePlannedMove", "mover");
+  auto waitBegin = std::chrono::steady_clock::now();
+  bool ready = pendingFuture.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready;
+  MotionTraceScope planWait("planWait", "mover");
+  ErrorCode result = pendingFuture.get();
+  planWait.finish();
+  double waited = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - waitBegin)
+                      .count();
+  pendingFuture = std::shared_future<ErrorCode>();
+  {
+    std::lock_guard<std::mutex> lock(planMutex);
+    planningStats.plansExecuted++;
+    if (ready) {
+      planningStats.readyBeforeNeeded++;
+    }
+    planningStats.totalWaitTime += waited;
+    planningStats.maxWaitTime = std::max(planningStats.maxWaitTime, waited);
+  }
+  if (result != ErrorCode::SUCCESS) {
+    return result;
+  }
+
+  // 버퍼 교체: 완료된 뒤 버퍼가 실행 버퍼가 되고, 이전 실행 버퍼는 다음
+  // 계획에 재사용
+  std::swap(activePlan, pendingPlan);
+
+  // 계획 이후 다른 이동 명령이나 형상 변경(스풀 교체, 온라인 보정)이
+  // 있었으면 현재 상태 기준으로 다시 계획
+  std::shared_ptr<const MotionConfig> config = currentParameters();
+  if (activePlan->sequence != motionSequence ||
+      activePlan->innerRadius != config->innerRadius ||
+      activePlan->wireThickness != config->wireThickness) {
+    {
+      std::lock_guard<std::mutex> lock(planMutex);
+      planningStats.stalePlans++;
+    }
+    planMotion(*config, currentPosition,
+               motor->getCurrentRotation(), activePlan->targetPosition,
+               *activePlan);
+  }
+
+  startMotion(*activePlan);
+  return ErrorCode::SUCCESS;
+}
+
+bool RollWireMover::hasPlannedMove() const {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  return pendingFuture.valid();
+}
+
+RollWireMover::PlanningStats RollWireMover::getPlanningStats() const {
+  std::lock_guard<std::mutex> lock(planMutex);
+  return planningStats;
+}
+
+void RollWireMover::resetPlanningStats() {
+  std::lock_guard<std::mutex> lock(planMutex);
+  planningStats = PlanningStats();
+}
+
+void RollWireMover::enableSnapshots(const std::string &path, bool durable) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  snapshotPath = path;
+  snapshotDurable = durable;
+}
+
+void RollWireMover::disableSnapshots() {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  snapshotPath.clear();
+}
+
+RollWireMover::ErrorCode RollWireMover::writeSnapshot() {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  if (motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY; // 이동이 끝난 상태만 기록
+  }
+  return writeSnapshotLocked();
+}
+
+RollWireMover::ErrorCode
+RollWireMover::restoreSnapshot(const std::string &path) {
+  SpoolSnapshot snapshot;
+  if (!SpoolSnapshotFile::read(path, snapshot)) {
+    return ErrorCode::SNAPSHOT_IO_ERROR;
+  }
+  return restoreSnapshot(snapshot);
+}
+
+RollWireMover::ErrorCode
+RollWireMover::restoreSnapshot(const SpoolSnapshot &snapshot) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  if (motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY;
+  }
+
+  // 와이어가 같고 모터가 꺼져 있는 동안 움직이지 않았어야 위치를 믿을 수 있음
+  std::shared_ptr<const MotionConfig> current = currentParameters();
+  if (snapshot.wireThickness != current->wireThickness ||
+      std::abs(snapshot.motorRotation - motor->getCurrentRotation()) >
+          SNAPSHOT_ROTATION_TOLERANCE) {
+    return ErrorCode::INVALID_SNAPSHOT;
+  }
+
+  ErrorCode result;
+  std::shared_ptr<const MotionConfig> config =
+      MotionConfig::create(snapshot.settings, snapshot.wireThickness,
+                           snapshot.innerRadius, result);
+  if (!config) {
+    return result;
+  }
+  if (snapshot.position < 0.0 || snapshot.position > config->maxWireLength) {
+    return ErrorCode::INVALID_SNAPSHOT;
+  }
+
+  if (config->controlPeriod != current->controlPeriod) {
+    motor->setControlPeriod(config->controlPeriod);
+  }
+  currentPosition = snapshot.position;
+  currentState = MotionState::STOPPED;
+  applyGeometry(std::move(config));
+  motionSequence = snapshot.moveCount;
+  publishStatus();
+  return ErrorCode::SUCCESS;
+}
+
+RollWireMover::SnapshotStats RollWireMover::getSnapshotStats() const {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  return snapshotStats;
+}
+
+RollWireMover::AllocationStats RollWireMover::getAllocationStats() const {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  AllocationStats stats = allocationStats;
+  stats.tracking = AllocationTracker::isInstalled();
+  return stats;
+}
+
+void RollWireMover::resetAllocationStats() {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  allocationStats = AllocationStats();
+}
+
+RollWireMover::AllocationMark RollWireMover::beginMoveAllocations() const {
+  AllocationMark mark;
+  if (!AllocationTracker::isInstalled()) {
+    return mark; // 훅이 없으면 원자적 카운터도 읽지 않음
+  }
+  AllocationTracker::Counters counters = AllocationTracker::read();
+  mark.allocations = counters.allocations;
+  mark.bytes = counters.bytes;
+  mark.liveBytes = AllocationTracker::beginWindow();
+  return mark;
+}
+
+void RollWireMover::endMoveAllocations(const AllocationMark &mark) {
+  if (!AllocationTracker::isInstalled()) {
+    return;
+  }
+  AllocationTracker::Counters counters = AllocationTracker::read();
+  allocationStats.moves++;
+  allocationStats.lastAllocations = counters.allocations - mark.allocations;
+  allocationStats.lastBytes = counters.bytes - mark.bytes;
+  allocationStats.lastPeakBytes =
+      AllocationTracker::windowPeak() - mark.liveBytes;
+  allocationStats.totalAllocations += allocationStats.lastAllocations;
+  allocationStats.totalBytes += allocationStats.lastBytes;
+  allocationStats.maxPeakBytes =
+      std::max(allocationStats.maxPeakBytes, allocationStats.lastPeakBytes);
+}
+
+RollWireMover::ErrorCode RollWireMover::writeSnapshotLocked() {
+  if (snapshotPath.empty()) {
+    return ErrorCode::SNAPSHOT_IO_ERROR;
+  }
+
+  std::shared_ptr<const MotionConfig> config = currentParameters();
+  SpoolSnapshot snapshot;
+  snapshot.position = currentPosition;
+  snapshot.motorRotation = motor->getCurrentRotation();
+  snapshot.wireThickness = config->wireThickness;
+  snapshot.innerRadius = config->innerRadius;
+  snapshot.moveCount = motionSequence;
+  snapshot.settings = config->getSettings();
+
+  auto begin = std::chrono::steady_clock::now();
+  bool written =
+      SpoolSnapshotFile::write(snapshotPath, snapshot, snapshotDurable);
+  double elapsed = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+  snapshotStats.totalWriteTime += elapsed;
+  snapshotStats.maxWriteTime = std::max(snapshotStats.maxWriteTime, elapsed);
+  if (!written) {
+    snapshotStats.failures++;
+    return ErrorCode::SNAPSHOT_IO_ERROR;
+  }
+  snapshotStats.writes++;
+  return ErrorCode::SUCCESS;
+}
+
+void RollWireMover::setOnlineCalibrator(
+    std::shared_ptr<OnlineCalibrator> calibrator) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  this->calibrator = std::move(calibrator);
+  // 연결 시점의 추정값은 다음 이동 명령에서 반영
+  appliedCalibrationVersion = 0;
+}
+
+RollWireMover::ErrorCode
+RollWireMover::recordMeasuredPosition(double measuredPosition) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  if (!calibrator) {
+    return ErrorCode::CALIBRATOR_NOT_SET;
+  }
+  if (motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY; // 정지 상태의 회전량만 위치와 대응
+  }
+  calibrator->addSample(measuredPosition, rotationFromOrigin());
+  return ErrorCode::SUCCESS;
+}
+
+void RollWireMover::applyCalibrationIfUpdated() {
+  // 이동 명령마다 호출: 새 추정값이 없으면 원자적 읽기 한 번으로 끝남
+  if (!calibrator || calibrator->getVersion() == appliedCalibrationVersion ||
+      motor->isRunning()) {
+    return;
+  }
+  uint64_t version = calibrator->getVersion();
+  OnlineCalibrator::Estimate estimate = calibrator->getEstimate();
+  appliedCalibrationVersion = version;
+
+  std::shared_ptr<const MotionConfig> next = currentParameters()->withGeometry(
+      estimate.wireThickness, estimate.innerRadius);
+  if (!next) {
+    return;
+  }
+  // 모터 회전량은 그대로이므로 새 형상에서 현재 위치를 다시 계산
+  double rotation = rotationFromOrigin();
+  currentPosition = std::min(std::max(0.0, next->getSpool().positionAtRotation(
+                                               rotation)),
+                             next->maxWireLength);
+  applyGeometry(std::move(next));
+  publishStatus();
+}
+
+void RollWireMover::applyGeometry(std::shared_ptr<const MotionConfig> config) {
+  // 변환은 게시된 설정의 SpoolGeometry로만 수행 (형상 사본을 두지 않음)
+  publishParameters(std::move(config));
+
+  // stop() 위치 역산 기준을 새 형상으로 다시 잡음
+  moveStartPosition = currentPosition;
+  moveStartRotation = motor->getCurrentRotation();
+  commandedEndRotation = moveStartRotation;
+}
+
+double RollWireMover::rotationFromOrigin() const {
+  return currentParameters()->getSpool().rotationAtPosition(moveStartPosition) +
+         motor->getCurrentRotation() - moveStartRotation;
+}
+
+void RollWireMover::snapshotIfIdle() {
+  // 실행 중인 이동은 끝난 뒤 writeSnapshot()으로 기록 (실패는 통계에 기록)
+  if (!snapshotPath.empty() && !motor->isRunning()) {
+    writeSnapshotLocked();
+  }
+}
+
+void RollWireMover::planWorkerLoop() {
+  std::unique_lock<std::mutex> lock(planMutex);
+  while (true) {
+    planCondition.wait(lock, [this] { return planWorkerExit || planRequest; });
+    if (!planRequest) {
+      return; // 종료 요청
+    }
+    std::unique_ptr<PlanRequest> request = std::move(planRequest);
+    lock.unlock();
+
+    auto begin = std::chrono::steady_clock::now();
+    planMotion(*request->config, request->startPosition,
+               request->startRotation, request->targetPosition,
+               *request->buffer);
+    double elapsed = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - begin)
+                         .count();
+
+    lock.lock();
+    planningStats.totalPlanTime += elapsed;
+    planningStats.maxPlanTime = std::max(planningStats.maxPlanTime, elapsed);
+    request->promise.set_value(request->buffer->result);
+  }
+}
+
+std::shared_ptr<const RollWireMover::MotionConfig>
+RollWireMover::currentParameters() const {
+  return std::atomic_load(&parameters);
+}
+
+RollWireMover::MotionSettings RollWireMover::currentSettings() const {
+  std::shared_ptr<const MotionConfig> current = currentParameters();
+  return current ? current->getSettings() : MotionSettings();
+}
+
+RollWireMover::ErrorCode
+RollWireMover::publishSettings(const MotionSettings &settings) {
+  // 검증과 파생 상수 계산은 게시 시 한 번만 수행
+  std::shared_ptr<const MotionConfig> current = currentParameters();
+  if (!current) {
+    return constructionError; // 생성 실패
+  }
+  ErrorCode result;
+  std::shared_ptr<const MotionConfig> next = MotionConfig::create(
+      settings, current->wireThickness, current->innerRadius, result);
+  if (next) {
+    publishParameters(std::move(next));
+  }
+  return result;
+}
+
+void RollWireMover::publishParameters(std::shared_ptr<const MotionConfig> next) {
+  // 이전 블록을 읽는 중인 스레드는 자신의 참조로 계속 사용
+  std::atomic_store(&parameters, std::move(next));
+}
+
+void RollWireMover::publishStatus() {
+  status.store(Status{currentPosition, currentState, motionSequence});
+}
+
+void RollWireMover::planMotion(const MotionConfig &p, double startPosition,
+                               double startRotation, double targetPosition,
+                               PlannedMotion &plan) {
+  MotionTraceScope trace("plan", "mover");
+  plan.result = ErrorCode::SUCCESS;
+  plan.innerRadius = p.innerRadius;
+  plan.wireThickness = p.wireThickness;
+  plan.startPosition = startPosition;
+  plan.targetPosition = targetPosition;
+  plan.endRotation = startRotation;
+  plan.parametric = false;
+  plan.rotations.clear();
+  plan.velocityProfile.clear();
+
+  double distance = targetPosition - startPosition;
+  if (std::abs(distance) < 0.000001) {
+    return; // 이동 없음
+  }
   bool isRetracting = (distance < 0); // 거리가 음수이면 감기(Retracting)
 
-  // 속도 프로파일 생성 (절대값 거리 사용)
-  std::vector<double> velocityProfile =
-      generateVelocityProfile(std::abs(distance));
+  if (p.planningSpace == PlanningSpace::ROTATION &&
+      p.profile != ProfileType::MINIMUM_TIME) {
+    // 회전 공간 계획: 각도 기준 사다리꼴을 샘플 배열로 전달
+    plan.rotations =
+        generateRotationSpaceProfile(p, startPosition, startRotation,
+                                     targetPosition, plan.velocityProfile);
+  } else if (p.trajectoryMode == TrajectoryMode::PARAMETRIC &&
+             p.profile != ProfileType::MINIMUM_TIME) {
+    // 매개변수 궤적 모드: 샘플 배열 없이 궤적 기술만 모터에 전달
+    // (최단 시간 프로파일은 닫힌 형태가 없으므로 항상 샘플 배열로 전달)
+    plan.parametric = true;
+    plan.trajectory = planTrajectory(p, std::abs(distance));
+    plan.trajectory.startRotation = startRotation;
+    plan.trajectory.startPosition = startPosition;
+    plan.trajectory.direction = isRetracting ? -1.0 : 1.0;
+    plan.trajectory.prepare();
+    size_t count = plan.trajectory.sampleCount();
+    if (count > 0) {
+      plan.endRotation = plan.trajectory.rotationAt(count - 1);
+    }
+    return;
+  } else {
+    // 속도 프로파일 생성 (절대값 거리 사용) 후 회전량 프로파일로 변환
+    plan.velocityProfile =
+        p.profile == ProfileType::MINIMUM_TIME
+            ? generateMinimumTimeProfile(p, startPosition, targetPosition)
+            : sampleVelocityProfile(planTrajectory(p, std::abs(distance)));
+    plan.rotations = convertToRotationProfile(
+        p, plan.velocityProfile, isRetracting, startPosition, startRotation);
+  }
+
+  if (!plan.rotations.empty()) {
+    plan.endRotation = plan.rotations.back();
+  }
+}
+
+void RollWireMover::startMotion(PlannedMotion &plan) {
+  if (std::abs(plan.targetPosition - plan.startPosition) < 0.000001) {
+    return; // 이동 없음
+  }
+  MotionTraceScope trace("handoff", "mover");
 
-  // 회전량 프로파일로 변환
-  std::vector<double> rotationProfile =
-      convertToRotationProfile(velocityProfile, isRetracting);
+  // stop() 시 위치 재계산 기준
+  moveStartPosition = plan.startPosition;
+  moveStartRotation = motor->getCurrentRotation();
 
-  // 모터 실행
-  motor->executeRotationProfile(rotationProfile);
+  // 디버그용 프로파일 기록 (매개변수 궤적은 속도 배열 없음)
+  captureVelocityProfile(plan.velocityProfile, motionSequence + 1);
+
+  if (plan.parametric) {
+    lastTrajectory = plan.trajectory;
+    motor->executeTrajectory(plan.trajectory);
+  } else {
+    // 모터 실행 (회전량 배열 소유권 이전, 복사 없음)
+    motor->executeRotationProfile(std::move(plan.rotations));
+  }
 
   // 상태 업데이트 (시뮬레이션이므로 즉시 완료 처리)
-  currentPosition = targetPosition;
+  currentPosition = plan.targetPosition;
+  commandedEndRotation = plan.endRotation;
+  motionSequence++;
+  publishStatus();
+  snapshotIfIdle();
+}
+
+RollWireMover::ErrorCode RollWireMover::queueMove(double targetPosition,
+                                                  double velocity) {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  std::shared_ptr<const MotionConfig> p = currentParameters();
+  if (targetPosition < 0.0 || targetPosition > p->maxWireLength) {
+    return ErrorCode::OUT_OF_RANGE;
+  }
+  if (velocity == 0.0) {
+    velocity = p->constantVelocity;
+  }
+  if (velocity < MIN_VELOCITY || velocity > MAX_VELOCITY) {
+    return ErrorCode::INVALID_VELOCITY;
+  }
+  motionQueue.push_back({false, targetPosition, velocity, 0.0});
+  return ErrorCode::SUCCESS;
+}
 
+RollWireMover::ErrorCode RollWireMover::queueDwell(double seconds) {
+  if (seconds < 0.0) {
+    return ErrorCode::INVALID_DWELL_TIME;
+  }
+  std::lock_guard<std::mutex> lock(commandMutex);
+  motionQueue.push_back({true, 0.0, 0.0, seconds});
   return ErrorCode::SUCCESS;
 }
 
-RollWireMover::ErrorCode RollWireMover::moveRelative(double distance) {
-  return moveTo(currentPosition + distance);
+RollWireMover::ErrorCode RollWireMover::executeQueue() {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  if (motor->isRunning()) {
+    return ErrorCode::MOTOR_BUSY; // 큐는 그대로 유지
+  }
+  applyCalibrationIfUpdated();
+  MotionTraceScope trace("executeQueue", "mover");
+  AllocationMark allocationMark = beginMoveAllocations();
+  MotionTraceScope plan("plan", "mover");
+  std::shared_ptr<const MotionConfig> config = currentParameters();
+  const MotionConfig &p = *config;
+  double position = currentPosition;
+  double rotation = motor->getCurrentRotation();
+  std::vector<double> rotationProfile;
+  std::vector<double> velocityProfile;
+
+  size_t i = 0;
+  while (i < motionQueue.size()) {
+    // 대기: 현재 회전량 유지
+    if (motionQueue[i].isDwell) {
+      size_t samples =
+          static_cast<size_t>(motionQueue[i].dwellTime / p.controlPeriod + 0.5);
+      rotationProfile.insert(rotationProfile.end(), samples, rotation);
+      velocityProfile.insert(velocityProfile.end(), samples, 0.0);
+      i++;
+      continue;
+    }
+
+    // 대기 없이 같은 방향으로 이어지는 이동을 하나의 구간으로 묶음
+    std::vector<double> waypoints;
+    std::vector<double> cruise;
+    double direction = 0.0;
+    double runEnd = position;
+    while (i < motionQueue.size() && !motionQueue[i].isDwell) {
+      double delta = motionQueue[i].target - runEnd;
+      if (std::abs(delta) < 0.000001) {
+        i++; // 이동 거리 0
+        continue;
+      }
+      double segmentDirection = (delta < 0.0) ? -1.0 : 1.0;
+      if (direction != 0.0 && segmentDirection != direction) {
+        break; // 방향 전환: 경유점에서 정지
+      }
+      direction = segmentDirection;
+      runEnd = motionQueue[i].target;
+      waypoints.push_back(runEnd);
+      cruise.push_back(motionQueue[i].velocity);
+      i++;
+    }
+    if (waypoints.empty()) {
+      continue;
+    }
+
+    std::vector<double> runVelocity =
+        planBlendedRun(p, position, waypoints, cruise);
+    std::vector<double> runRotation = convertToRotationProfile(
+        p, runVelocity, direction < 0.0, position, rotation);
+    rotationProfile.insert(rotationProfile.end(), runRotation.begin(),
+                           runRotation.end());
+    velocityProfile.insert(velocityProfile.end(), runVelocity.begin(),
+                           runVelocity.end());
+    position = runEnd;
+    rotation = runRotation.back();
+  }
+  motionQueue.clear();
+  plan.finish();
+
+  if (rotationProfile.empty()) {
+    return ErrorCode::SUCCESS;
+  }
+
+  // 디버그용: 큐 전체의 속도 프로파일 기록 (실제로 전달하는 이동만)
+  captureVelocityProfile(velocityProfile, motionSequence + 1);
+  MotionTraceScope handoff("handoff", "mover");
+
+  // stop() 시 위치 재계산 기준
+  moveStartPosition = currentPosition;
+  moveStartRotation = motor->getCurrentRotation();
+
+  motor->executeRotationProfile(std::move(rotationProfile));
+  currentPosition = position;
+  commandedEndRotation = rotation;
+  motionSequence++;
+  publishStatus();
+  snapshotIfIdle();
+  endMoveAllocations(allocationMark);
+  return ErrorCode::SUCCESS;
 }
 
-std::vector<double> RollWireMover::generateVelocityProfile(double distance) {
-  std::vector<double> profile;
-  double dt = 0.001; // 1ms 샘플링
+void RollWireMover::clearQueue() {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  motionQueue.clear();
+}
+
+size_t RollWireMover::getQueuedCount() const {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  return motionQueue.size();
+}
+
+std::vector<double>
+RollWireMover::planBlendedRun(const MotionConfig &p, double startPosition,
+                              const std::vector<double> &waypoints,
+                              const std::vector<double> &cruise) {
+  double distance = std::abs(waypoints.back() - startPosition);
+  size_t segments = pathGridSegments(distance);
+  double ds = distance / segments;
+
+  // 격자점별 속도 한계: 해당 구간의 정속 속도
+  // 경유점 근처(반 격자 이내)에서는 인접 구간 중 느린 속도
+  std::vector<double> velocityLimit(segments + 1);
+  size_t segment = 0;
+  for (size_t g = 0; g <= segments; g++) {
+    double s = g * ds;
+    while (segment + 1 < waypoints.size() &&
+           s > std::abs(waypoints[segment] - startPosition) + 0.5 * ds) {
+      segment++;
+    }
+    double limit = cruise[segment];
+    double boundary = std::abs(waypoints[segment] - startPosition);
+    if (segment + 1 < waypoints.size() && std::abs(s - boundary) <= 0.5 * ds) {
+      limit = std::min(limit, cruise[segment + 1]);
+    }
+    velocityLimit[g] = limit;
+  }
+
+  // 가감속도는 기본 설정(정속 속도 / 가감속 시간)으로 고정
+  std::vector<double> accelLimit(segments + 1,
+                                 p.constantVelocity / p.accelerationTime);
+  std::vector<double> decelLimit(segments + 1,
+                                 p.constantVelocity / p.decelerationTime);
+  return timeParameterizePath(p, distance, velocityLimit, accelLimit,
+                              decelLimit);
+}
+
+std::vector<double>
+RollWireMover::generateRotationSpaceProfile(const MotionConfig &p,
+                                            double startPosition,
+                                            double startRotation,
+                                            double targetPosition,
+                                            std::vector<double> &wireVelocity) {
+  const SpoolGeometry &spool = p.getSpool();
+  double baseRotation = spool.rotationAtPosition(startPosition);
+  double angle = spool.rotationAtPosition(targetPosition) - baseRotation;
+  double direction = (angle < 0.0) ? -1.0 : 1.0;
+
+  // 각도 기준 사다리꼴 (정속 각속도: RPM → 도/초)
+  // 모터 한계를 정속 RPM 아래로 낮췄으면 한계 RPM으로 계획
+  double rpm = std::min(p.constantRpm, p.maxMotorRpm);
+  MotionTrajectory ramp = planRamp(p, std::abs(angle), rpm * 6.0);
+  ramp.controlPeriod = p.controlPeriod;
+  size_t count = ramp.sampleCount();
+
+  // 롤 기준 회전량 샘플
+  std::vector<double> rotationProfile(count);
+  for (size_t k = 0; k < count; k++) {
+    rotationProfile[k] = baseRotation + direction * ramp.distanceAt(k);
+  }
+
+  // 회전량 → 와이어 위치 일괄 변환 후 주기 평균 와이어 속도 계산
+  std::vector<double> positions(count);
+  spool.positionsAtRotations(rotationProfile.data(), positions.data(), count);
+  wireVelocity.resize(count);
+  double previous = startPosition;
+  for (size_t k = 0; k < count; k++) {
+    wireVelocity[k] = std::abs(positions[k] - previous) / p.controlPeriod;
+    previous = positions[k];
+  }
+
+  // 모터의 현재 회전량 기준으로 이동
+  for (double &rotation : rotationProfile) {
+    rotation += startRotation - baseRotation;
+  }
+  return rotationProfile;
+}
+
+MotionTrajectory RollWireMover::planTrajectory(const MotionConfig &p,
+                                               double distance) {
+  MotionTrajectory trajectory = planRamp(p, distance, p.constantVelocity);
+
+  // 형상 및 샘플 주기 (시작 회전량과 방향은 호출 측에서 설정)
+  trajectory.controlPeriod = p.controlPeriod;
+  trajectory.wireThickness = p.wireThickness;
+  trajectory.innerRadius = p.innerRadius;
+  trajectory.totalWireLength = p.maxWireLength;
+  return trajectory;
+}
+
+MotionTrajectory RollWireMover::planRamp(const MotionConfig &p,
+                                         double distance,
+                                         double cruiseVelocity) {
+  if (p.quantizationMode == QuantizationMode::EXACT_DISTANCE) {
+    return planExactDistanceTrajectory(p, distance, cruiseVelocity);
+  }
+  return planRoundedTrajectory(p, distance, cruiseVelocity);
+}
+
+MotionTrajectory
+RollWireMover::planRoundedTrajectory(const MotionConfig &p,
+                                     double distance, double cruiseVelocity) {
+  MotionTrajectory trajectory;
+  double dt = p.controlPeriod; // 제어 주기 샘플링
 
   // 가속 거리 = 0.5 * a * t^2 = 0.5 * (v/t_acc) * t_acc^2 = 0.5 * v * t_acc
-  double accDist = 0.5 * constantVelocity * accelerationTime;
-  double decDist = 0.5 * constantVelocity * decelerationTime;
+  double accDist = 0.5 * cruiseVelocity * p.accelerationTime;
+  double decDist = 0.5 * cruiseVelocity * p.decelerationTime;
 
   // 정속 구간이 존재하는지 확인
   if (distance >= accDist + decDist) {
     // 정속 구간 존재
     double constDist = distance - accDist - decDist;
-    double constTime = constDist / constantVelocity;
-
-    // 가속 구간 (반복 횟수 계산)
-    int accSteps = static_cast<int>(accelerationTime / dt + 0.5);
-    for (int i = 0; i < accSteps; i++) {
-      double t = i * dt;
-      double v = (t / accelerationTime) * constantVelocity;
-      profile.push_back(v);
-    }
+    double constTime = constDist / cruiseVelocity;
 
-    // 정속 구간 (반복 횟수 계산)
-    int constSteps = static_cast<int>(constTime / dt + 0.5);
-    for (int i = 0; i < constSteps; i++) {
-      profile.push_back(constantVelocity);
-    }
+    trajectory.peakVelocity = cruiseVelocity;
+    trajectory.accRampTime = p.accelerationTime;
+    trajectory.decRampTime = p.decelerationTime;
 
-    // 감속 구간 (반복 횟수 계산)
-    int decSteps = static_cast<int>(decelerationTime / dt + 0.5);
-    for (int i = 0; i < decSteps; i++) {
-      double t = i * dt;
-      double v = constantVelocity * (1.0 - (t / decelerationTime));
-      profile.push_back(v);
-    }
-    // 마지막 값을 명시적으로 0으로 설정
-    profile.push_back(0.0);
+    // 구간별 반복 횟수 계산 (램프 길이는 설정 게시 시 미리 계산됨)
+    trajectory.accSteps = p.accelerationSteps;
+    trajectory.constSteps = static_cast<int>(constTime / dt + 0.5);
+    trajectory.decSteps = p.decelerationSteps;
   } else {
     // 정속 구간 없음 (삼각형 프로파일)
-    double v_peak = std::sqrt((2 * distance * constantVelocity) /
-                              (accelerationTime + decelerationTime));
-
-    double t_acc_actual = accelerationTime * (v_peak / constantVelocity);
-    double t_dec_actual = decelerationTime * (v_peak / constantVelocity);
-
-    // 가속 구간 (반복 횟수 계산)
-    int accSteps = static_cast<int>(t_acc_actual / dt + 0.5);
-    for (int i = 0; i < accSteps; i++) {
-      double t = i * dt;
-      double v = (t / t_acc_actual) * v_peak;
-      profile.push_back(v);
-    }
+    double v_peak = std::sqrt((2 * distance * cruiseVelocity) /
+                              (p.accelerationTime + p.decelerationTime));
 
-    // 감속 구간 (반복 횟수 계산)
-    int decSteps = static_cast<int>(t_dec_actual / dt + 0.5);
-    for (int i = 0; i < decSteps; i++) {
-      double t = i * dt;
-      double v = v_peak * (1.0 - (t / t_dec_actual));
-      profile.push_back(v);
-    }
-    // 마지막 값을 명시적으로 0으로 설정
-    profile.push_back(0.0);
+    double t_acc_actual = p.accelerationTime * (v_peak / cruiseVelocity);
+    double t_dec_actual = p.decelerationTime * (v_peak / cruiseVelocity);
+
+    trajectory.peakVelocity = v_peak;
+    trajectory.accRampTime = t_acc_actual;
+    trajectory.decRampTime = t_dec_actual;
+
+    // 구간별 반복 횟수 계산
+    trajectory.accSteps = static_cast<int>(t_acc_actual / dt + 0.5);
+    trajectory.constSteps = 0;
+    trajectory.decSteps = static_cast<int>(t_dec_actual / dt + 0.5);
   }
 
-  // 테스트용: 마지막 프로파일 저장
-  lastVelocityProfile = profile;
+  return trajectory;
+}
+
+MotionTrajectory
+RollWireMover::planExactDistanceTrajectory(const MotionConfig &p,
+                                           double distance,
+                                           double cruiseVelocity) {
+  MotionTrajectory trajectory;
+  double dt = p.controlPeriod; // 제어 주기 샘플링
+
+  // 연속 시간 기준 구간 시간과 최고 속도 계산 (반올림 모드와 동일한 형상)
+  double peakVelocity = cruiseVelocity;
+  double accTime = p.accelerationTime;
+  double decTime = p.decelerationTime;
+  double constTime = 0.0;
 
+  double accDist = 0.5 * cruiseVelocity * p.accelerationTime;
+  double decDist = 0.5 * cruiseVelocity * p.decelerationTime;
+  if (distance >= accDist + decDist) {
+    constTime = (distance - accDist - decDist) / cruiseVelocity;
+  } else {
+    peakVelocity = std::sqrt((2 * distance * cruiseVelocity) /
+                             (p.accelerationTime + p.decelerationTime));
+    accTime = p.accelerationTime * (peakVelocity / cruiseVelocity);
+    decTime = p.decelerationTime * (peakVelocity / cruiseVelocity);
+  }
+
+  // 각 구간을 정수 샘플 수로 올림 (구간이 짧아져 가감속이 커지지 않도록)
+  // 정속 구간이 있으면 램프 길이는 설정 게시 시 미리 계산한 값을 사용
+  const double eps = 1e-9; // 0.1, 0.2 등의 부동소수점 오차 흡수
+  int accSteps = p.exactAccelerationSteps;
+  int decSteps = p.exactDecelerationSteps;
+  if (constTime <= 0.0) {
+    accSteps = std::max(1, static_cast<int>(std::ceil(accTime / dt - eps)));
+    decSteps = std::max(1, static_cast<int>(std::ceil(decTime / dt - eps)));
+  }
+  int constSteps =
+      std::max(0, static_cast<int>(std::ceil(constTime / dt - eps)));
+
+  // 이산 적분: Σv·dt = v·dt·(accSteps/2 + constSteps + decSteps/2)
+  // 이 값이 distance와 정확히 같아지도록 최고 속도를 해석적으로 재계산한다.
+  // 구간을 올림했으므로 v는 항상 peakVelocity 이하이다.
+  trajectory.peakVelocity =
+      distance / (dt * (0.5 * accSteps + constSteps + 0.5 * decSteps));
+
+  // 램프 시간을 정수 샘플 길이에 맞춰 가속 끝/감속 시작이 정확히 v가 되도록 함
+  trajectory.accSteps = accSteps;
+  trajectory.constSteps = constSteps;
+  trajectory.decSteps = decSteps;
+  trajectory.accRampTime = accSteps * dt;
+  trajectory.decRampTime = decSteps * dt;
+
+  return trajectory;
+}
+
+std::vector<double>
+RollWireMover::sampleVelocityProfile(const MotionTrajectory &trajectory) {
+  std::vector<double> profile;
+  size_t count = trajectory.sampleCount();
+  profile.reserve(count);
+  for (size_t k = 0; k < count; k++) {
+    profile.push_back(trajectory.velocityAt(k));
+  }
   return profile;
 }
 
 std::vector<double> RollWireMover::convertToRotationProfile(
-    const std::vector<double> &velocityProfile, bool isRetracting) {
+    const MotionConfig &p, const std::vector<double> &velocityProfile,
+    bool isRetracting, double startPosition, double startRotation) {
   std::vector<double> rotationProfile;
-  double currentRotation = motor->getCurrentRotation();
-  double dt = 0.001;
+  rotationProfile.reserve(velocityProfile.size());
+
+  // 누적 이동 거리 → 위치 → 회전량 (반지름 변화 반영)
+  // 시작 회전량 기준 상대값을 사용하므로 모터의 현재 회전량과 연속됨
+  const SpoolGeometry &spool = p.getSpool();
+  double baseRotation = spool.rotationAtPosition(startPosition);
+  double direction = isRetracting ? -1.0 : 1.0;
+  double dt = p.controlPeriod;
+  double travelled = 0.0;
 
   for (double v : velocityProfile) {
-    double ds = v * dt; // 이동 거리
+    travelled += v * dt; // 이동 거리
+    double position = startPosition + direction * travelled;
+    rotationProfile.push_back(startRotation +
+                              spool.rotationAtPosition(position) -
+                              baseRotation);
+  }
+
+  return rotationProfile;
+}
+
+std::vector<double>
+RollWireMover::generateMinimumTimeProfile(const MotionConfig &p,
+                                          double startPosition,
+                                          double targetPosition) {
+  const SpoolGeometry &spool = p.getSpool();
+  double distance = std::abs(targetPosition - startPosition);
+  double direction = (targetPosition < startPosition) ? -1.0 : 1.0;
 
-    // 거리를 회전량으로 변환 (Calculator 사용)
-    double dRot = calculator->calculateRotation(ds);
+  // 격자점별 속도/가속도 한계
+  //   v ≤ min(MAX_VELOCITY, ω_max · r(s)),  a ≤ α_max · r(s)
+  size_t segments = pathGridSegments(distance);
+  double ds = distance / segments;
 
-    if (isRetracting) {
-      currentRotation -= dRot;
-    } else {
-      currentRotation += dRot;
+  double maxOmega = p.maxAngularVelocityRad;     // rad/s
+  double maxAlpha = p.maxAngularAccelerationRad; // rad/s²
+
+  std::vector<double> velocityLimit(segments + 1);
+  std::vector<double> accelLimit(segments + 1);
+  for (size_t i = 0; i <= segments; i++) {
+    double radius = spool.radiusAtPosition(startPosition + direction * i * ds) /
+                    1000.0; // mm → m
+    velocityLimit[i] = std::min(MAX_VELOCITY, maxOmega * radius);
+    accelLimit[i] = maxAlpha * radius;
+  }
+
+  return timeParameterizePath(p, distance, velocityLimit, accelLimit,
+                              accelLimit);
+}
+
+size_t RollWireMover::pathGridSegments(double distance) {
+  // 양 끝이 정지이므로 속도가 0보다 큰 내부 격자점이 하나 이상 필요
+  // (구간이 하나면 v = [0, 0]이 되어 구간 시간이 무한대)
+  size_t segments =
+      static_cast<size_t>(std::ceil(distance / PATH_GRID_STEP));
+  return std::min(std::max<size_t>(segments, 2), PATH_MAX_GRID_SEGMENTS);
+}
+
+std::vector<double> RollWireMover::timeParameterizePath(
+    const MotionConfig &p, double distance,
+    const std::vector<double> &velocityLimit,
+    const std::vector<double> &accelLimit,
+    const std::vector<double> &decelLimit) {
+  size_t segments = velocityLimit.size() - 1;
+  double ds = distance / segments;
+  double dt = p.controlPeriod;
+
+  // 1. 전진 패스 (가속 한계) / 후진 패스 (감속 한계), 양 끝은 정지
+  std::vector<double> v(segments + 1, 0.0);
+  for (size_t i = 1; i <= segments; i++) {
+    double a = std::min(accelLimit[i - 1], accelLimit[i]);
+    v[i] = std::min(velocityLimit[i],
+                    std::sqrt(v[i - 1] * v[i - 1] + 2 * a * ds));
+  }
+  v[segments] = 0.0;
+  for (size_t i = segments; i-- > 0;) {
+    double a = std::min(decelLimit[i], decelLimit[i + 1]);
+    v[i] = std::min(v[i], std::sqrt(v[i + 1] * v[i + 1] + 2 * a * ds));
+  }
+
+  // 2. 시간 매개변수화: 각 격자 구간은 등가속도 운동
+  //    제어 주기마다 위치를 구하고, 주기 평균 속도를 샘플로 사용하여
+  //    누적 거리가 요청 거리와 정확히 일치하도록 함
+  //    전체 이동 시간으로 샘플 수 상한을 두어, 속도 한계가 0인 격자가
+  //    있어도 반복이 끝나도록 함 (남은 거리는 마지막 샘플로 보정)
+  double totalTime = 0.0;
+  for (size_t i = 0; i < segments; i++) {
+    totalTime += 2.0 * ds / (v[i] + v[i + 1]);
+  }
+  size_t maxSamples = std::isfinite(totalTime)
+                          ? static_cast<size_t>(std::ceil(totalTime / dt)) + 1
+                          : 0;
+
+  std::vector<double> profile;
+  profile.push_back(0.0);
+
+  size_t segment = 0;
+  double segmentStart = 0.0; // 현재 구간 시작 시각
+  double previous = 0.0;     // 직전 샘플 위치 (시작점 기준 거리)
+  for (size_t k = 1; k <= maxSamples; k++) {
+    double t = k * dt;
+
+    // t가 속한 구간 찾기
+    double segmentTime = 2.0 * ds / (v[segment] + v[segment + 1]);
+    while (segment < segments && t > segmentStart + segmentTime) {
+      segmentStart += segmentTime;
+      segment++;
+      if (segment < segments) {
+        segmentTime = 2.0 * ds / (v[segment] + v[segment + 1]);
+      }
+    }
+
+    double position = distance;
+    if (segment < segments) {
+      double tau = t - segmentStart;
+      double a = (v[segment + 1] * v[segment + 1] - v[segment] * v[segment]) /
+                 (2.0 * ds);
+      position = std::min(segment * ds + v[segment] * tau + 0.5 * a * tau * tau,
+                          (segment + 1) * ds);
     }
 
-    rotationProfile.push_back(currentRotation);
+    profile.push_back((position - previous) / dt);
+    previous = position;
+    if (segment >= segments) {
+      break;
+    }
+  }
+  if (previous < distance) {
+    profile.push_back((distance - previous) / dt);
   }
 
-  return rotationProfile;
+  // 마지막 정지 샘플
+  profile.push_back(0.0);
+  return profile;
+}
+
+RollWireMover::ErrorCode
+RollWireMover::setProfileCapture(ProfileCaptureMode mode, size_t historyDepth,
+                                 size_t maxSamples) {
+  if (mode == ProfileCaptureMode::HISTORY && historyDepth == 0) {
+    return ErrorCode::INVALID_CAPTURE_CONFIG;
+  }
+  std::lock_guard<std::mutex> lock(commandMutex);
+  profileCapture = mode;
+  profileMaxSamples = maxSamples;
+  // 사용하지 않는 기록은 메모리까지 해제
+  std::vector<double>().swap(lastVelocityProfile);
+  std::vector<CapturedProfile> history(
+      mode == ProfileCaptureMode::HISTORY ? historyDepth : 0);
+  profileHistory.swap(history);
+  profileHistoryNext = 0;
+  profileHistoryCount = 0;
+  return ErrorCode::SUCCESS;
+}
+
+RollWireMover::ProfileCaptureMode RollWireMover::getProfileCaptureMode() const {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  return profileCapture;
+}
+
+std::vector<RollWireMover::CapturedProfile>
+RollWireMover::getProfileHistory() const {
+  std::lock_guard<std::mutex> lock(commandMutex);
+  std::vector<CapturedProfile> history;
+  history.reserve(profileHistoryCount);
+  size_t depth = profileHistory.size();
+  for (size_t i = 0; i < profileHistoryCount; i++) {
+    history.push_back(
+        profileHistory[(profileHistoryNext + depth - profileHistoryCount + i) %
+                       depth]);
+  }
+  return history;
+}
+
+void RollWireMover::captureVelocityProfile(std::vector<double> &velocityProfile,
+                                           uint64_t sequence) {
+  switch (profileCapture) {
+  case ProfileCaptureMode::OFF:
+    return;
+  case ProfileCaptureMode::LAST:
+    lastVelocityProfile.swap(velocityProfile);
+    return;
+  case ProfileCaptureMode::HISTORY:
+    break;
+  }
+
+  // 가장 오래된 칸과 버퍼 교환 (밀려난 기록은 호출 측 벡터와 함께 해제)
+  CapturedProfile &slot = profileHistory[profileHistoryNext];
+  slot.velocity.swap(velocityProfile);
+  slot.sequence = sequence;
+  slot.decimation = 1;
+  if (profileMaxSamples > 0 && slot.velocity.size() > profileMaxSamples) {
+    // 제자리 솎음: 0, k, 2k, ... 번째 샘플만 유지 (재할당 없음)
+    size_t k = (slot.velocity.size() + profileMaxSamples - 1) /
+               profileMaxSamples;
+    size_t kept = 0;
+    for (size_t i = 0; i < slot.velocity.size(); i += k) {
+      slot.velocity[kept++] = slot.velocity[i];
+    }
+    slot.velocity.resize(kept);
+    slot.decimation = k;
+  }
+  profileHistoryNext = (profileHistoryNext + 1) % profileHistory.size();
+  profileHistoryCount = std::min(profileHistoryCount + 1, profileHistory.size());
 }
 
 const std::vector<double> &RollWireMover::getLastVelocityProfile() const {
+  if (profileCapture == ProfileCaptureMode::HISTORY &&
+      profileHistoryCount > 0) {
+    size_t depth = profileHistory.size();
+    return profileHistory[(profileHistoryNext + depth - 1) % depth].velocity;
+  }
   return lastVelocityProfile;
 }
+
+const MotionTrajectory &RollWireMover::getLastTrajectory() const {
+  return lastTrajectory;
+}
@@ -1,6 +1,14 @@
 #include "SimMotor.h"
+#include "MotionTrace.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
-SimMotor::SimMotor() : currentRotation(0.0), running(false), currentIndex(0) {}
+SimMotor::SimMotor()
+    : currentRotation(0.0), running(false), trajectoryLoaded(false),
+      currentIndex(0), controlPeriod(0.001), elapsedTime(0.0),
+      executionMode(ExecutionMode::IMMEDIATE), timeWarp(false),
+      callbackInterval(0), callbackCounter(0), dynamicsEnabled(false) {}
 
 void SimMotor::executeRotationProfile(const std::vector<double> &rotations) {
   // 빈 배열이면 아무것도 하지 않음
@@ -8,57 +16,321 @@ void SimMotor::executeRotationProfile(const std::vector<double> &rotations) {
     return;
   }
 
+  // 호출 측 배열은 유지되어야 하므로 복사하여 보관
+  runProfile(std::make_shared<const std::vector<double>>(rotations));
+}
+
+void SimMotor::executeRotationProfile(std::vector<double> &&rotations) {
+  if (rotations.empty()) {
+    return;
+  }
+
+  // 버퍼 소유권만 이전 (원소 복사 없음)
+  runProfile(std::make_shared<const std::vector<double>>(std::move(rotations)));
+}
+
+void SimMotor::executeRotationProfile(
+    std::shared_ptr<const std::vector<double>> rotations) {
+  if (!rotations || rotations->empty()) {
+    return;
+  }
+
+  // 호출 측 버퍼를 공유 (원소 복사 없음)
+  runProfile(std::move(rotations));
+}
+
+void SimMotor::runProfile(
+    std::shared_ptr<const std::vector<double>> rotations) {
   // 프로파일 저장 및 실행 시작
-  profile = rotations;
+  storeProfile(std::move(rotations));
+  currentIndex = 0;
   running = true; // 실행 중 상태로 설정
+  MotionTrace::instant("start", "motor",
+                       static_cast<double>(profile->size()));
+
+  // 단계 실행 모드: step 계열 호출로 진행
+  if (executionMode == ExecutionMode::STEPPED) {
+    return;
+  }
+
+  // 동역학 모델은 모든 샘플을 적분하며 동기 실행
+  if (dynamicsEnabled) {
+    advanceSamples(profile->size());
+    return;
+  }
 
   // 프로파일 실행 (현재는 동기적으로 즉시 완료)
-  // TODO: 향후 비동기 또는 단계별 실행으로 변경 필요
-  currentRotation = rotations.back();
+  currentRotation = profile->back();
+  elapsedTime += profile->size() * controlPeriod;
 
   // 실행 완료 후 정지 상태로 변경
   running = false;
+  MotionTrace::instant("complete", "motor", currentRotation);
+}
+
+void SimMotor::storeProfile(
+    std::shared_ptr<const std::vector<double>> rotations) {
+  profile = std::move(rotations);
+  trajectoryLoaded = false;
+}
+
+void SimMotor::executeTrajectory(const MotionTrajectory &trajectory) {
+  // 궤적만 보관하고 배열로 전개하지 않음
+  this->trajectory = trajectory;
+  this->trajectory.prepare(); // 샘플마다 형상을 다시 만들지 않도록
+  trajectoryLoaded = true;
+  profile.reset();
+  currentIndex = 0;
+  running = true;
+  MotionTrace::instant("start", "motor",
+                       static_cast<double>(trajectory.sampleCount()));
+
+  if (executionMode == ExecutionMode::STEPPED) {
+    return;
+  }
+
+  if (dynamicsEnabled) {
+    advanceSamples(trajectory.sampleCount());
+    return;
+  }
+
+  // 동기 실행: 마지막 샘플의 회전량을 바로 평가
+  currentRotation = trajectory.finalRotation();
+  elapsedTime += trajectory.duration();
+
+  running = false;
+  MotionTrace::instant("complete", "motor", currentRotation);
 }
 
 void SimMotor::stop() {
   // 실행 중단 - 현재 위치는 유지
   running = false;
+  MotionTrace::instant("stop", "motor", currentRotation);
 }
 
 double SimMotor::getCurrentRotation() const { return currentRotation; }
 
 bool SimMotor::isRunning() const { return running; }
 
-void SimMotor::resetPosition() { currentRotation = 0.0; }
+void SimMotor::resetPosition() {
+  currentRotation = 0.0;
+  if (dynamicsEnabled) {
+    dynamics.resetAxis(0, 0.0);
+  }
+}
+
+void SimMotor::restoreRotation(double rotation) {
+  currentRotation = rotation;
+  if (dynamicsEnabled) {
+    dynamics.resetAxis(0, rotation);
+  }
+}
+
+void SimMotor::setControlPeriod(double period) { controlPeriod = period; }
+
+double SimMotor::getControlPeriod() const { return controlPeriod; }
+
+double SimMotor::getElapsedTime() const { return elapsedTime; }
 
 void SimMotor::loadProfile(const std::vector<double> &rotations) {
   // 프로파일을 로드하지만 실행하지는 않음
-  profile = rotations;
+  storeProfile(std::make_shared<const std::vector<double>>(rotations));
+  currentIndex = 0;
+}
+
+void SimMotor::loadProfile(std::vector<double> &&rotations) {
+  storeProfile(
+      std::make_shared<const std::vector<double>>(std::move(rotations)));
+  currentIndex = 0;
+}
+
+void SimMotor::loadProfile(
+    std::shared_ptr<const std::vector<double>> rotations) {
+  storeProfile(std::move(rotations));
+  currentIndex = 0;
+}
+
+void SimMotor::loadTrajectory(const MotionTrajectory &trajectory) {
+  // 궤적을 로드하지만 실행하지는 않음
+  this->trajectory = trajectory;
+  this->trajectory.prepare(); // 샘플마다 형상을 다시 만들지 않도록
+  trajectoryLoaded = true;
+  profile.reset();
   currentIndex = 0;
 }
 
 void SimMotor::startExecution() {
   // 실행 시작
-  if (!profile.empty()) {
+  if (loadedSampleCount() > 0) {
     running = true;
     currentIndex = 0;
+    MotionTrace::instant("start", "motor",
+                         static_cast<double>(loadedSampleCount()));
   }
 }
 
 void SimMotor::step() {
   // 한 스텝 실행
-  if (!running || currentIndex >= profile.size()) {
+  stepN(1);
+}
+
+size_t SimMotor::stepN(size_t count) {
+  if (!running) {
+    return 0;
+  }
+  count = std::min(count, loadedSampleCount() - currentIndex);
+
+  size_t advanced = 0;
+  while (advanced < count) {
+    // 다음 콜백 경계까지 한 번에 진행
+    size_t chunk = count - advanced;
+    bool hasCallback = stepCallback && callbackInterval > 0;
+    if (hasCallback) {
+      chunk = std::min(chunk, callbackInterval - callbackCounter);
+    }
+
+    advanceSamples(chunk);
+    advanced += chunk;
+
+    if (hasCallback) {
+      callbackCounter += chunk;
+      if (callbackCounter == callbackInterval) {
+        callbackCounter = 0;
+        stepCallback(*this);
+        // 콜백이 stop()으로 정지시켰으면 남은 샘플은 진행하지 않음
+        if (!running) {
+          break;
+        }
+      }
+    }
+  }
+  return advanced;
+}
+
+size_t SimMotor::runUntil(double time) {
+  if (!running || time <= elapsedTime) {
+    return 0;
+  }
+  // 남은 시간을 샘플 수로 환산 (부동소수점 오차 흡수)
+  double samples = (time - elapsedTime) / controlPeriod;
+  return stepN(static_cast<size_t>(std::ceil(samples - 1e-9)));
+}
+
+void SimMotor::setStepCallback(StepCallback callback, size_t interval) {
+  stepCallback = std::move(callback);
+  callbackInterval = interval;
+  callbackCounter = 0;
+}
+
+void SimMotor::setTimeWarp(bool enabled) { timeWarp = enabled; }
+
+void SimMotor::setExecutionMode(ExecutionMode mode) { executionMode = mode; }
+
+SimMotor::ExecutionMode SimMotor::getExecutionMode() const {
+  return executionMode;
+}
+
+void SimMotor::enableDynamics(const MotorDynamicsParams &params) {
+  // 현재 회전량에서 정지 상태로 시작
+  dynamics = MotorDynamicsBank(params);
+  dynamics.addAxis(currentRotation);
+  dynamicsEnabled = true;
+}
+
+void SimMotor::disableDynamics() { dynamicsEnabled = false; }
+
+bool SimMotor::isDynamicsEnabled() const { return dynamicsEnabled; }
+
+FollowingErrorStats SimMotor::getFollowingErrorStats() const {
+  if (!dynamicsEnabled) {
+    return FollowingErrorStats();
+  }
+  return dynamics.getFollowingErrorStats(0);
+}
+
+double SimMotor::sampleAt(size_t index) const {
+  // 궤적은 실행 시점에 평가
+  return trajectoryLoaded ? trajectory.rotationAt(index) : (*profile)[index];
+}
+
+void SimMotor::advanceSamples(size_t count) {
+  if (count == 0) {
     return;
   }
+  size_t end = currentIndex + count;
+
+  if (dynamicsEnabled) {
+    // 매 샘플을 목표값으로 동역학 적분
+    for (size_t i = currentIndex; i < end; ++i) {
+      dynamics.advanceAxis(0, sampleAt(i), controlPeriod);
+    }
+    currentRotation = dynamics.getRotation(0);
+  } else if (timeWarp) {
+    // 중간 샘플은 건너뛰고 마지막 샘플만 평가
+    currentRotation = sampleAt(end - 1);
+  } else if (trajectoryLoaded) {
+    for (size_t i = currentIndex; i < end; ++i) {
+      currentRotation = trajectory.rotationAt(i);
+    }
+  } else {
+    const double *samples = profile->data();
+    for (size_t i = currentIndex; i < end; ++i) {
+      currentRotation = samples[i];
+    }
+  }
 
-  // 현재 인덱스의 회전량 적용
-  currentRotation = profile[currentIndex];
-  currentIndex++;
+  size_t begin = currentIndex;
+  currentIndex = end;
+  elapsedTime += count * controlPeriod;
 
   // 마지막 스텝이었다면 실행 종료
-  if (currentIndex >= profile.size()) {
+  if (currentIndex >= loadedSampleCount()) {
     running = false;
   }
+  if (MotionTrace::isEnabled()) {
+    traceAdvance(begin, end);
+  }
 }
 
-const std::vector<double> &SimMotor::getLastProfile() const { return profile; }
+void SimMotor::traceAdvance(size_t begin, size_t end) const {
+  // 이번 스텝에서 지난 궤적 구간 경계 (샘플 배열은 구간 정보가 없음)
+  if (trajectoryLoaded) {
+    size_t cruiseStart = trajectory.accSteps;
+    size_t decelStart = cruiseStart + trajectory.constSteps;
+    if (begin == 0 && trajectory.accSteps > 0) {
+      MotionTrace::instant("accelerate", "motor", 0.0);
+    }
+    if (begin <= cruiseStart && cruiseStart < end &&
+        trajectory.constSteps > 0) {
+      MotionTrace::instant("cruise", "motor",
+                           static_cast<double>(cruiseStart));
+    }
+    if (begin <= decelStart && decelStart < end && trajectory.decSteps > 0) {
+      MotionTrace::instant("decelerate", "motor",
+                           static_cast<double>(decelStart));
+    }
+  }
+
+  MotionTrace::counter("rotation", "motor", currentRotation);
+  if (!running) {
+    MotionTrace::instant("complete", "motor", currentRotation);
+  }
+}
+
+const std::vector<double> &SimMotor::getLastProfile() const {
+  static const std::vector<double> emptyProfile;
+  return profile ? *profile : emptyProfile;
+}
+
+const MotionTrajectory &SimMotor::getLastTrajectory() const {
+  return trajectory;
+}
+
+bool SimMotor::hasTrajectory() const { return trajectoryLoaded; }
+
+size_t SimMotor::loadedSampleCount() const {
+  if (trajectoryLoaded) {
+    return trajectory.sampleCount();
+  }
+  return profile ? profile->size() : 0;
+}
@@ -0,0 +1,158 @@
+#include "SimMotorBank.h"
+#include <algorithm>
+
+namespace {
+// arena 정리를 시작하는 최소 크기 (샘플)
+const size_t MIN_COMPACT_THRESHOLD = 1 << 16;
+} // namespace
+
+/**
+ * @brief 뱅크의 한 모터를 Motor 인터페이스로 노출하는 핸들
+ */
+class SimMotorBank::BankMotor : public Motor {
+public:
+  BankMotor(SimMotorBank &bank, size_t index) : bank(bank), index(index) {}
+
+  void executeRotationProfile(const std::vector<double> &rotations) override {
+    bank.load(index, rotations.data(), rotations.size());
+  }
+
+  void stop() override { bank.stop(index); }
+
+  double getCurrentRotation() const override {
+    return bank.getCurrentRotation(index);
+  }
+
+  bool isRunning() const override { return bank.isRunning(index); }
+
+  void resetPosition() override { bank.resetPosition(index); }
+
+  void setControlPeriod(double period) override {
+    bank.setControlPeriod(period);
+  }
+
+private:
+  SimMotorBank &bank;
+  size_t index;
+};
+
+SimMotorBank::SimMotorBank(double controlPeriod)
+    : controlPeriod(controlPeriod), elapsedTime(0.0),
+      compactThreshold(MIN_COMPACT_THRESHOLD) {}
+
+SimMotorBank::~SimMotorBank() = default;
+
+size_t SimMotorBank::addMotor() {
+  size_t index = rotation.size();
+  rotation.push_back(0.0);
+  offset.push_back(0);
+  length.push_back(0);
+  cursor.push_back(0);
+  handles.push_back(std::make_unique<BankMotor>(*this, index));
+  return index;
+}
+
+size_t SimMotorBank::size() const { return rotation.size(); }
+
+Motor &SimMotorBank::motor(size_t index) { return *handles[index]; }
+
+void SimMotorBank::stepAll() {
+  const size_t count = rotation.size();
+  double *rot = rotation.data();
+  const size_t *off = offset.data();
+  const size_t *len = length.data();
+  size_t *cur = cursor.data();
+  const double *samples = arena.data();
+
+  // 정지한 모터는 마지막 값을 유지하도록 선택 연산으로 처리 (분기 없음)
+  for (size_t i = 0; i < count; ++i) {
+    size_t c = cur[i];
+    bool active = c < len[i];
+    size_t sampleIndex = off[i] + (active ? c : 0);
+    double sample = active ? samples[sampleIndex] : rot[i];
+    rot[i] = sample;
+    cur[i] = c + active;
+  }
+
+  elapsedTime += controlPeriod;
+}
+
+void SimMotorBank::stepAll(size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    stepAll();
+  }
+}
+
+size_t SimMotorBank::runUntilIdle() {
+  // 가장 긴 잔여 프로파일만큼 진행
+  size_t remaining = 0;
+  for (size_t i = 0; i < rotation.size(); ++i) {
+    remaining = std::max(remaining, length[i] - cursor[i]);
+  }
+  stepAll(remaining);
+  return remaining;
+}
+
+size_t SimMotorBank::getRunningCount() const {
+  size_t running = 0;
+  for (size_t i = 0; i < rotation.size(); ++i) {
+    running += cursor[i] < length[i];
+  }
+  return running;
+}
+
+double SimMotorBank::getCurrentRotation(size_t index) const {
+  return rotation[index];
+}
+
+bool SimMotorBank::isRunning(size_t index) const {
+  return cursor[index] < length[index];
+}
+
+void SimMotorBank::setControlPeriod(double period) { controlPeriod = period; }
+
+double SimMotorBank::getControlPeriod() const { return controlPeriod; }
+
+double SimMotorBank::getElapsedTime() const { return elapsedTime; }
+
+void SimMotorBank::load(size_t index, const double *samples, size_t count) {
+  // 기존 프로파일은 폐기
+  stop(index);
+
+  // 이 모터의 구간이 arena 끝에 있으면 그 자리에 덮어씀
+  if (offset[index] + cursor[index] == arena.size()) {
+    arena.resize(offset[index]);
+  }
+
+  // 임계 크기에 도달하면 재생이 끝난 구간을 정리 (분할 상환 O(1))
+  if (arena.size() + count > compactThreshold) {
+    compact();
+    compactThreshold =
+        std::max(MIN_COMPACT_THRESHOLD, 2 * (arena.size() + count));
+  }
+
+  offset[index] = arena.size();
+  length[index] = count;
+  cursor[index] = 0;
+  arena.insert(arena.end(), samples, samples + count);
+}
+
+void SimMotorBank::stop(size_t index) { length[index] = cursor[index]; }
+
+void SimMotorBank::resetPosition(size_t index) { rotation[index] = 0.0; }
+
+void SimMotorBank::compact() {
+  // 실행 중인 모터의 남은 구간만 새 버퍼로 옮기고 재생 위치를 0으로 재설정
+  std::vector<double> compacted;
+  for (size_t i = 0; i < rotation.size(); ++i) {
+    size_t remaining = length[i] - cursor[i];
+    size_t start = compacted.size();
+    compacted.insert(compacted.end(),
+                     arena.begin() + offset[i] + cursor[i],
+                     arena.begin() + offset[i] + length[i]);
+    offset[i] = start;
+    length[i] = remaining;
+    cursor[i] = 0;
+  }
+  arena.swap(compacted);
+}
@@ -0,0 +1,51 @@
+#include "SpoolGeometry.h"
+#include <algorithm>
+
+SpoolGeometry::SpoolGeometry(double wireThickness, double innerRadius,
+                             double totalWireLength)
+    : calculator(wireThickness, innerRadius),
+      totalWireLength(totalWireLength),
+      fullRotation(calculator.calculateRotationFromLength(
+          std::max(0.0, totalWireLength))) {}
+
+double SpoolGeometry::rotationAtPosition(double position) const {
+  return fullRotation -
+         calculator.calculateRotationFromLength(woundLength(position));
+}
+
+double SpoolGeometry::positionAtRotation(double rotation) const {
+  double woundRotation = std::max(0.0, fullRotation - rotation);
+  return totalWireLength -
+         calculator.calculateLengthFromRotation(woundRotation);
+}
+
+void SpoolGeometry::positionsAtRotations(const double *rotations,
+                                         double *positions,
+                                         size_t count) const {
+  // 감긴 회전량 → 감긴 길이 → 위치 (positions를 중간 버퍼로 사용)
+  for (size_t i = 0; i < count; ++i) {
+    positions[i] = std::max(0.0, fullRotation - rotations[i]);
+  }
+  calculator.calculateLengthsFromRotations(positions, positions, count);
+  for (size_t i = 0; i < count; ++i) {
+    positions[i] = totalWireLength - positions[i];
+  }
+}
+
+double SpoolGeometry::radiusAtPosition(double position) const {
+  double woundRotation =
+      calculator.calculateRotationFromLength(woundLength(position));
+  return calculator.getInnerRadius() +
+         woundRotation / 360.0 * calculator.getWireThickness();
+}
+
+const RollWireCalculator &SpoolGeometry::getCalculator() const {
+  return calculator;
+}
+
+double SpoolGeometry::getTotalWireLength() const { return totalWireLength; }
+
+double SpoolGeometry::woundLength(double position) const {
+  // 범위를 벗어난 위치(부동소수점 오차)는 코어 기준으로 제한
+  return std::max(0.0, totalWireLength - position);
+}
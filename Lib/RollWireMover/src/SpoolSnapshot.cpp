@@ -0,0 +1,217 @@
+#include "SpoolSnapshot.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+const uint8_t MAGIC[4] = {'R', 'W', 'S', 'S'};
+const uint32_t VERSION = 1;
+const size_t PAYLOAD_SIZE = SpoolSnapshotFile::ENCODED_SIZE - sizeof(uint64_t);
+
+// 필드를 고정 길이로 순서대로 기록/복원 (호스트 바이트 순서)
+class Writer {
+public:
+  explicit Writer(uint8_t *buffer) : cursor(buffer) {}
+  template <typename T> void put(T value) {
+    std::memcpy(cursor, &value, sizeof(T));
+    cursor += sizeof(T);
+  }
+
+private:
+  uint8_t *cursor;
+};
+
+class Reader {
+public:
+  explicit Reader(const uint8_t *buffer) : cursor(buffer) {}
+  template <typename T> T get() {
+    T value;
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return value;
+  }
+
+private:
+  const uint8_t *cursor;
+};
+
+uint64_t checksum(const uint8_t *data, size_t size) {
+  // FNV-1a 64비트
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+template <typename Enum> uint32_t toWire(Enum value) {
+  return static_cast<uint32_t>(value);
+}
+
+// 범위를 벗어난 열거값은 손상으로 처리
+template <typename Enum>
+bool fromWire(uint32_t value, uint32_t count, Enum &out) {
+  if (value >= count) {
+    return false;
+  }
+  out = static_cast<Enum>(value);
+  return true;
+}
+
+bool writeAll(int fd, const uint8_t *data, size_t size) {
+  while (size > 0) {
+    ssize_t written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+// rename()으로 바뀐 디렉터리 항목을 디스크에 내림 (path가 속한 디렉터리)
+bool syncParentDirectory(const std::string &path) {
+  size_t slash = path.find_last_of('/');
+  std::string directory = slash == std::string::npos ? "."
+                          : slash == 0               ? "/"
+                                                     : path.substr(0, slash);
+  int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = ::fsync(fd) == 0;
+  return (::close(fd) == 0) && ok;
+}
+
+} // namespace
+
+void SpoolSnapshotFile::encode(const SpoolSnapshot &snapshot,
+                               uint8_t (&buffer)[ENCODED_SIZE]) {
+  const RollWireMover::MotionSettings &s = snapshot.settings;
+  std::memcpy(buffer, MAGIC, sizeof(MAGIC));
+  Writer out(buffer + sizeof(MAGIC));
+  out.put(VERSION);
+  out.put(snapshot.position);
+  out.put(snapshot.motorRotation);
+  out.put(snapshot.wireThickness);
+  out.put(snapshot.innerRadius);
+  out.put(snapshot.moveCount);
+  out.put(s.accelerationTime);
+  out.put(s.constantVelocity);
+  out.put(s.decelerationTime);
+  out.put(s.controlPeriod);
+  out.put(s.maxWireLength);
+  out.put(s.maxMotorRpm);
+  out.put(s.maxAngularAcceleration);
+  out.put(s.constantRpm);
+  out.put(toWire(s.profile));
+  out.put(toWire(s.quantizationMode));
+  out.put(toWire(s.trajectoryMode));
+  out.put(toWire(s.planningSpace));
+  out.put(checksum(buffer, PAYLOAD_SIZE));
+}
+
+bool SpoolSnapshotFile::decode(const uint8_t (&buffer)[ENCODED_SIZE],
+                               SpoolSnapshot &snapshot) {
+  if (std::memcmp(buffer, MAGIC, sizeof(MAGIC)) != 0) {
+    return false;
+  }
+  uint64_t stored;
+  std::memcpy(&stored, buffer + PAYLOAD_SIZE, sizeof(stored));
+  if (stored != checksum(buffer, PAYLOAD_SIZE)) {
+    return false;
+  }
+
+  Reader in(buffer + sizeof(MAGIC));
+  if (in.get<uint32_t>() != VERSION) {
+    return false;
+  }
+  SpoolSnapshot result;
+  RollWireMover::MotionSettings &s = result.settings;
+  result.position = in.get<double>();
+  result.motorRotation = in.get<double>();
+  result.wireThickness = in.get<double>();
+  result.innerRadius = in.get<double>();
+  result.moveCount = in.get<uint64_t>();
+  s.accelerationTime = in.get<double>();
+  s.constantVelocity = in.get<double>();
+  s.decelerationTime = in.get<double>();
+  s.controlPeriod = in.get<double>();
+  s.maxWireLength = in.get<double>();
+  s.maxMotorRpm = in.get<double>();
+  s.maxAngularAcceleration = in.get<double>();
+  s.constantRpm = in.get<double>();
+  if (!fromWire(in.get<uint32_t>(), 3, s.profile) ||
+      !fromWire(in.get<uint32_t>(), 2, s.quantizationMode) ||
+      !fromWire(in.get<uint32_t>(), 2, s.trajectoryMode) ||
+      !fromWire(in.get<uint32_t>(), 2, s.planningSpace)) {
+    return false;
+  }
+
+  snapshot = result;
+  return true;
+}
+
+bool SpoolSnapshotFile::write(const std::string &path,
+                              const SpoolSnapshot &snapshot, bool durable) {
+  uint8_t buffer[ENCODED_SIZE];
+  encode(snapshot, buffer);
+
+  // 임시 파일에 완전히 쓴 뒤 rename()으로 교체 (같은 파일 시스템 내 원자적)
+  std::string temporary = path + ".tmp";
+  int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = writeAll(fd, buffer, ENCODED_SIZE);
+  if (ok && durable) {
+    ok = ::fsync(fd) == 0;
+  }
+  ok = (::close(fd) == 0) && ok;
+  if (!ok || std::rename(temporary.c_str(), path.c_str()) != 0) {
+    ::unlink(temporary.c_str());
+    return false;
+  }
+  // 교체 자체도 전원 차단 후 남도록 디렉터리까지 동기화
+  return !durable || syncParentDirectory(path);
+}
+
+bool SpoolSnapshotFile::read(const std::string &path,
+                             SpoolSnapshot &snapshot) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  // 정확히 ENCODED_SIZE 바이트여야 함 (잘린 파일, 덧붙은 파일 거부)
+  uint8_t buffer[ENCODED_SIZE];
+  size_t total = 0;
+  bool ok = true;
+  while (total < ENCODED_SIZE) {
+    ssize_t count = ::read(fd, buffer + total, ENCODED_SIZE - total);
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count <= 0) {
+      ok = false;
+      break;
+    }
+    total += static_cast<size_t>(count);
+  }
+  uint8_t extra;
+  if (ok && ::read(fd, &extra, 1) != 0) {
+    ok = false;
+  }
+  ::close(fd);
+
+  return ok && decode(buffer, snapshot);
+}
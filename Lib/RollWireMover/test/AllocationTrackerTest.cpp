@@ -0,0 +1,95 @@
+#include "AllocationTracker.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+// 이 파일은 할당 훅을 링크한 rollwiremover_alloc_test에서만 실행된다
+
+// Phase 31.1: 할당 훅 집계
+TEST(AllocationTrackerTest, HookIsInstalledAndCountsAllocations) {
+  ASSERT_TRUE(AllocationTracker::isInstalled());
+  AllocationTracker::Counters before = AllocationTracker::read();
+
+  std::unique_ptr<std::vector<double>> buffer(new std::vector<double>(1000));
+  AllocationTracker::Counters during = AllocationTracker::read();
+  buffer.reset();
+  AllocationTracker::Counters after = AllocationTracker::read();
+
+  EXPECT_EQ(before.allocations + 2, during.allocations); // 벡터 객체 + 버퍼
+  EXPECT_GE(during.bytes - before.bytes, 1000 * sizeof(double));
+  EXPECT_GE(during.liveBytes - before.liveBytes,
+            static_cast<int64_t>(1000 * sizeof(double)));
+  EXPECT_EQ(before.liveBytes, after.liveBytes);
+  EXPECT_EQ(during.deallocations + 2, after.deallocations);
+  EXPECT_GE(during.peakLiveBytes, during.liveBytes);
+}
+
+TEST(AllocationTrackerTest, WindowPeakTracksHighWaterSinceBegin) {
+  // 구간 최고점은 해제 후에도 구간 중 가장 높았던 사용량을 유지한다
+  int64_t start = AllocationTracker::beginWindow();
+  {
+    std::vector<double> large(100000);
+    large[0] = 1.0;
+  }
+  EXPECT_GE(AllocationTracker::windowPeak() - start,
+            static_cast<int64_t>(100000 * sizeof(double)));
+  EXPECT_EQ(start, AllocationTracker::read().liveBytes);
+}
+
+// Phase 31.2: 이동당 할당 집계
+TEST(AllocationTrackerTest, MoverReportsPerMoveAllocations) {
+  // 샘플 배열 이동은 프로파일 크기 이상의 바이트를 할당하고 최고점에 반영된다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  mover.moveTo(1.0);
+  RollWireMover::AllocationStats stats = mover.getAllocationStats();
+  size_t samples = mover.getLastVelocityProfile().size();
+
+  EXPECT_TRUE(stats.tracking);
+  EXPECT_EQ(1u, stats.moves);
+  EXPECT_GT(stats.lastAllocations, 0u);
+  EXPECT_GE(stats.lastBytes, samples * sizeof(double));
+  EXPECT_GE(stats.lastPeakBytes, static_cast<int64_t>(samples * sizeof(double)));
+  EXPECT_EQ(stats.lastAllocations, stats.totalAllocations);
+
+  mover.moveTo(0.5);
+  stats = mover.getAllocationStats();
+  EXPECT_EQ(2u, stats.moves);
+  EXPECT_GE(stats.maxPeakBytes, stats.lastPeakBytes);
+}
+
+TEST(AllocationTrackerTest, ParametricMoveAllocatesLessThanSampled) {
+  // 매개변수 궤적 전달은 샘플 배열을 만들지 않으므로 할당 바이트가 적다
+  SimMotor sampledMotor;
+  SimMotor parametricMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover sampled(1.0, 50.0, &sampledMotor, error);
+  RollWireMover parametric(1.0, 50.0, &parametricMotor, error);
+  parametric.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+
+  sampled.moveTo(2.0);
+  parametric.moveTo(2.0);
+
+  EXPECT_LT(parametric.getAllocationStats().lastBytes,
+            sampled.getAllocationStats().lastBytes);
+}
+
+TEST(AllocationTrackerTest, ZeroDistanceMoveIsNotCounted) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  mover.moveTo(0.0);
+  EXPECT_EQ(0u, mover.getAllocationStats().moves);
+
+  mover.moveTo(0.5);
+  mover.resetAllocationStats();
+  RollWireMover::AllocationStats stats = mover.getAllocationStats();
+  EXPECT_EQ(0u, stats.moves);
+  EXPECT_EQ(0u, stats.totalBytes);
+  EXPECT_TRUE(stats.tracking);
+}
@@ -0,0 +1,341 @@
+#include "MotionTrace.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// 추적 상태는 프로세스 전역이므로 테스트마다 비우고 끝나면 비활성화
+class MotionTraceTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    MotionTrace::disable();
+    MotionTrace::clear();
+  }
+  void TearDown() override {
+    MotionTrace::disable();
+    MotionTrace::clear();
+  }
+};
+
+// 분류가 category인 이벤트를 "이름:종류" 문자열로 나열
+std::vector<std::string> describe(const std::vector<MotionTrace::Event> &events,
+                                  const char *category) {
+  std::vector<std::string> names;
+  for (const MotionTrace::Event &event : events) {
+    if (std::strcmp(event.category, category) == 0) {
+      names.push_back(std::string(event.name) + ":" +
+                      static_cast<char>(event.phase));
+    }
+  }
+  return names;
+}
+
+size_t countNamed(const std::vector<MotionTrace::Event> &events,
+                  const char *name, MotionTrace::Phase phase) {
+  size_t count = 0;
+  for (const MotionTrace::Event &event : events) {
+    count += std::strcmp(event.name, name) == 0 && event.phase == phase;
+  }
+  return count;
+}
+
+// 문자열 밖의 괄호 짝과 문자열 종료만 확인하는 간단한 JSON 구조 검사
+bool isBalancedJson(const std::string &text) {
+  std::vector<char> stack;
+  bool inString = false;
+  for (size_t i = 0; i < text.size(); i++) {
+    char c = text[i];
+    if (inString) {
+      if (c == '\\') {
+        i++;
+      } else if (c == '"') {
+        inString = false;
+      }
+      continue;
+    }
+    if (c == '"') {
+      inString = true;
+    } else if (c == '{' || c == '[') {
+      stack.push_back(c);
+    } else if (c == '}' || c == ']') {
+      if (stack.empty() || stack.back() != (c == '}' ? '{' : '[')) {
+        return false;
+      }
+      stack.pop_back();
+    }
+  }
+  return stack.empty() && !inString;
+}
+
+} // namespace
+
+// Phase 33.1: 비활성 상태
+TEST_F(MotionTraceTest, DisabledRecordsNothing) {
+  // 비활성 상태에서는 이동과 스텝 실행이 이벤트를 남기지 않는다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_FALSE(MotionTrace::isEnabled());
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(1.0));
+  mover.stop();
+
+  EXPECT_TRUE(MotionTrace::collect().empty());
+  EXPECT_EQ(0u, MotionTrace::droppedEvents());
+}
+
+TEST_F(MotionTraceTest, ScopeStartedWhileDisabledRecordsNoEnd) {
+  // 비활성 상태에서 시작한 구간은 도중에 활성화되어도 끝을 기록하지 않는다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  {
+    MotionTraceScope scope("outer", "test");
+    MotionTrace::enable();
+    MotionTrace::instant("inside", "test");
+  }
+  EXPECT_EQ((std::vector<std::string>{"inside:i"}),
+            describe(MotionTrace::collect(), "test"));
+}
+
+// Phase 33.2: 이동 추적
+TEST_F(MotionTraceTest, MoveRecordsPlanAndHandoffInsideMove) {
+  // moveTo는 계획 → 모터 전달 순서의 구간을 남기고, 모터는 전달 구간 안에서
+  // 실행 시작/완료를 기록한다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  MotionTrace::enable();
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(1.0));
+
+  std::vector<MotionTrace::Event> events = MotionTrace::collect();
+  EXPECT_EQ((std::vector<std::string>{"moveTo:B", "plan:B", "plan:E",
+                                      "handoff:B", "handoff:E", "moveTo:E"}),
+            describe(events, "mover"));
+  EXPECT_EQ((std::vector<std::string>{"start:i", "complete:i"}),
+            describe(events, "motor"));
+
+  // 시각순 정렬, 모터 이벤트는 전달 구간 안
+  for (size_t i = 1; i < events.size(); i++) {
+    EXPECT_LE(events[i - 1].timestampNs, events[i].timestampNs);
+  }
+  EXPECT_EQ(std::string("handoff"), events[3].name);
+  EXPECT_EQ(std::string("start"), events[4].name);
+  EXPECT_EQ(std::string("complete"), events[5].name);
+  EXPECT_DOUBLE_EQ(simMotor.getCurrentRotation(), events[5].value);
+}
+
+TEST_F(MotionTraceTest, SteppedTrajectoryRecordsPhasesStepsAndStop) {
+  // 단계 실행 궤적은 가속/정속/감속 전환과 스텝마다 회전량 카운터를 남기고,
+  // 정지 명령은 모터와 이동기 양쪽에 기록된다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.setAccelerationTime(0.1);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.1);
+  MotionTrace::enable();
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(1.0));
+  const MotionTrajectory &trajectory = simMotor.getLastTrajectory();
+  ASSERT_GT(trajectory.accSteps, 0u);
+  ASSERT_GT(trajectory.constSteps, 0u);
+  ASSERT_GT(trajectory.decSteps, 0u);
+
+  size_t steps = 0;
+  while (simMotor.stepN(50) > 0) {
+    steps++;
+  }
+  mover.stop();
+
+  std::vector<MotionTrace::Event> events = MotionTrace::collect();
+  std::vector<std::string> motor = describe(events, "motor");
+  ASSERT_GE(motor.size(), 6u);
+  EXPECT_EQ("start:i", motor.front());
+  EXPECT_EQ("stop:i", motor.back());
+  EXPECT_EQ("complete:i", motor[motor.size() - 2]);
+  EXPECT_EQ(steps, countNamed(events, "rotation", MotionTrace::Phase::COUNTER));
+
+  // 구간 전환은 한 번씩, 가속 → 정속 → 감속 순서
+  std::vector<std::string> phases;
+  for (const std::string &name : motor) {
+    if (name == "accelerate:i" || name == "cruise:i" ||
+        name == "decelerate:i") {
+      phases.push_back(name);
+    }
+  }
+  EXPECT_EQ((std::vector<std::string>{"accelerate:i", "cruise:i",
+                                      "decelerate:i"}),
+            phases);
+  EXPECT_EQ(2u, countNamed(events, "stop", MotionTrace::Phase::INSTANT));
+  EXPECT_EQ("stop:i", describe(events, "mover").back());
+}
+
+TEST_F(MotionTraceTest, BackgroundPlanningRecordsOnWorkerThread) {
+  // 백그라운드 계획은 계획 작업자 스레드 번호로 기록된다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  MotionTrace::enable();
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.planMove(1.0).get());
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executePlannedMove());
+
+  std::vector<MotionTrace::Event> events = MotionTrace::collect();
+  uint32_t planThread = 0;
+  uint32_t commandThread = 0;
+  for (const MotionTrace::Event &event : events) {
+    if (std::strcmp(event.name, "plan") == 0) {
+      planThread = event.threadId;
+    }
+    if (std::strcmp(event.name, "executePlannedMove") == 0) {
+      commandThread = event.threadId;
+    }
+  }
+  EXPECT_NE(0u, planThread);
+  EXPECT_NE(0u, commandThread);
+  EXPECT_NE(planThread, commandThread);
+  EXPECT_EQ(1u, countNamed(events, "planWait", MotionTrace::Phase::BEGIN));
+  EXPECT_EQ(1u, countNamed(events, "handoff", MotionTrace::Phase::END));
+}
+
+// Phase 33.3: 스레드별 링 버퍼
+TEST_F(MotionTraceTest, FullThreadBufferKeepsLatestEvents) {
+  // 버퍼가 가득 차면 가장 오래된 이벤트부터 덮어쓰고 버린 수를 보고한다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  MotionTrace::enable(8); // 새 스레드 버퍼 크기
+  std::thread writer([] {
+    for (int i = 0; i < 10; i++) {
+      MotionTrace::counter("count", "ring", i);
+    }
+  });
+  writer.join();
+  MotionTrace::enable();
+
+  std::vector<MotionTrace::Event> events = MotionTrace::collect();
+  ASSERT_EQ(8u, events.size());
+  for (size_t i = 0; i < events.size(); i++) {
+    EXPECT_DOUBLE_EQ(static_cast<double>(i + 2), events[i].value);
+  }
+  EXPECT_EQ(2u, MotionTrace::droppedEvents());
+
+  MotionTrace::clear();
+  EXPECT_TRUE(MotionTrace::collect().empty());
+  EXPECT_EQ(0u, MotionTrace::droppedEvents());
+}
+
+TEST_F(MotionTraceTest, ExistingThreadBufferKeepsItsCapacity) {
+  // enable(capacity)는 이미 버퍼가 있는 스레드의 크기를 바꾸지 않는다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  MotionTrace::enable();
+  MotionTrace::instant("first", "ring");
+  MotionTrace::enable(4);
+  for (int i = 0; i < 10; i++) {
+    MotionTrace::counter("count", "ring", i);
+  }
+
+  EXPECT_EQ(11u, describe(MotionTrace::collect(), "ring").size());
+  EXPECT_EQ(0u, MotionTrace::droppedEvents());
+}
+
+TEST_F(MotionTraceTest, CollectWhileRecordingReturnsOnlyWholeEvents) {
+  // 작은 버퍼를 계속 덮어쓰는 동안 읽어도 이벤트는 온전하고 순서대로이다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  MotionTrace::enable(16);
+  std::atomic<bool> done(false);
+  std::thread writer([&done] {
+    for (int i = 0; i < 200000; i++) {
+      MotionTrace::counter("count", "race", i);
+    }
+    done = true;
+  });
+
+  size_t bad = 0;
+  while (!done.load()) {
+    double previous = -1.0;
+    for (const MotionTrace::Event &event : MotionTrace::collect()) {
+      if (std::strcmp(event.category, "race") != 0) {
+        continue;
+      }
+      bad += std::strcmp(event.name, "count") != 0 ||
+             event.phase != MotionTrace::Phase::COUNTER ||
+             event.value <= previous;
+      previous = event.value;
+    }
+  }
+  writer.join();
+  MotionTrace::enable();
+
+  EXPECT_EQ(0u, bad);
+  EXPECT_EQ(16u, describe(MotionTrace::collect(), "race").size());
+}
+
+// Phase 33.4: Chrome 추적 JSON 내보내기
+TEST_F(MotionTraceTest, ExportsChromeTraceJson) {
+  // traceEvents 배열에 ph/ts/pid/tid와 카운터 값을 담은 JSON을 쓴다
+  if (!MotionTrace::isAvailable()) {
+    GTEST_SKIP() << "trace compiled out";
+  }
+  MotionTrace::enable();
+  MotionTrace::begin("span", "test");
+  MotionTrace::counter("rotation", "test", 12.5);
+  MotionTrace::instant("quote\"name", "test");
+  MotionTrace::end("span", "test");
+
+  std::ostringstream out;
+  MotionTrace::exportChromeTrace(out);
+  std::string json = out.str();
+
+  EXPECT_EQ(0u, json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+  EXPECT_TRUE(isBalancedJson(json));
+  EXPECT_NE(std::string::npos,
+            json.find("{\"name\":\"span\",\"cat\":\"test\",\"ph\":\"B\","
+                      "\"ts\":0.000,\"pid\":1,\"tid\":"));
+  EXPECT_NE(std::string::npos, json.find("\"ph\":\"E\""));
+  EXPECT_NE(std::string::npos, json.find("\"args\":{\"value\":12.5}"));
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"quote\\\"name\""));
+  EXPECT_NE(std::string::npos, json.find("\"s\":\"t\""));
+}
+
+TEST_F(MotionTraceTest, ExportsToFileAndReportsFailure) {
+  // 파일로 내보내고, 쓸 수 없는 경로는 false
+  std::string path = ::testing::TempDir() + "motion_trace_test.json";
+  ASSERT_TRUE(MotionTrace::exportChromeTrace(path));
+  std::ifstream in(path);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  EXPECT_TRUE(isBalancedJson(contents.str()));
+  EXPECT_NE(std::string::npos, contents.str().find("\"traceEvents\":["));
+  std::remove(path.c_str());
+
+  EXPECT_FALSE(MotionTrace::exportChromeTrace(
+      "/nonexistent-directory/motion_trace_test.json"));
+}
@@ -0,0 +1,199 @@
+#include "FixedPoint.h"
+#include "MotionTrajectory.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include "SpoolGeometry.h"
+#include "TrajectoryKernel.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+// Phase 13.1: MotionTrajectory 평가
+static MotionTrajectory makeTrajectory() {
+  MotionTrajectory trajectory;
+  trajectory.controlPeriod = 0.001;
+  trajectory.accSteps = 100;
+  trajectory.constSteps = 300;
+  trajectory.decSteps = 200;
+  trajectory.peakVelocity = 0.5;
+  trajectory.accRampTime = 0.1;
+  trajectory.decRampTime = 0.2;
+  trajectory.startRotation = 10.0;
+  trajectory.startPosition = 2.0;
+  trajectory.direction = 1.0;
+  trajectory.wireThickness = 1.0;
+  trajectory.innerRadius = 50.0;
+  return trajectory;
+}
+
+TEST(MotionTrajectoryTest, SampleCountIncludesFinalZeroSample) {
+  // 전체 샘플 수는 구간 샘플 수의 합 + 1 (마지막 0)이다
+  MotionTrajectory trajectory = makeTrajectory();
+
+  EXPECT_EQ(601u, trajectory.sampleCount());
+  EXPECT_NEAR(0.601, trajectory.duration(), 1e-12);
+}
+
+TEST(MotionTrajectoryTest, VelocityFollowsTrapezoidShape) {
+  // 속도는 가속 → 정속 → 감속 → 0 순서의 사다리꼴 형태이다
+  MotionTrajectory trajectory = makeTrajectory();
+
+  EXPECT_DOUBLE_EQ(0.0, trajectory.velocityAt(0));
+  EXPECT_NEAR(0.25, trajectory.velocityAt(50), 1e-12);
+  EXPECT_DOUBLE_EQ(0.5, trajectory.velocityAt(100));
+  EXPECT_DOUBLE_EQ(0.5, trajectory.velocityAt(399));
+  EXPECT_DOUBLE_EQ(0.5, trajectory.velocityAt(400));
+  EXPECT_NEAR(0.25, trajectory.velocityAt(500), 1e-12);
+  EXPECT_DOUBLE_EQ(0.0, trajectory.velocityAt(600));
+}
+
+TEST(MotionTrajectoryTest, DistanceMatchesSummedVelocities) {
+  // 닫힌 형태의 누적 거리는 샘플 속도의 합과 일치한다
+  MotionTrajectory trajectory = makeTrajectory();
+
+  double sum = 0.0;
+  for (size_t k = 0; k < trajectory.sampleCount(); ++k) {
+    sum += trajectory.velocityAt(k) * trajectory.controlPeriod;
+    ASSERT_NEAR(sum, trajectory.distanceAt(k), 1e-12) << "at sample " << k;
+  }
+}
+
+TEST(MotionTrajectoryTest, RotationIsRelativeToStartAndDirection) {
+  // 회전량은 시작 회전량 기준이며 direction에 따라 부호가 바뀐다
+  MotionTrajectory forward = makeTrajectory();
+  MotionTrajectory backward = makeTrajectory();
+  backward.direction = -1.0;
+  SpoolGeometry spool(1.0, 50.0, forward.totalWireLength);
+
+  double distance = forward.distanceAt(forward.sampleCount() - 1);
+  double expected = spool.rotationAtPosition(2.0 + distance) -
+                    spool.rotationAtPosition(2.0);
+  double delta = forward.finalRotation() - forward.startRotation;
+  EXPECT_NEAR(expected, delta, 1e-9);
+
+  // 감는 쪽은 반지름이 커서 같은 거리에 대한 회전량이 더 작다
+  double backwardDelta = backward.finalRotation() - backward.startRotation;
+  EXPECT_LT(backwardDelta, 0.0);
+  EXPECT_LT(std::abs(backwardDelta), delta);
+}
+
+TEST(MotionTrajectoryTest, PreparedTrajectoryMatchesUnpreparedEvaluation) {
+  // prepare() 후 평가는 매번 형상을 만드는 평가와 같고, 시작 위치를 바꾸면
+  // 다시 준비하기 전까지 바뀐 값으로 계산된다
+  MotionTrajectory plain = makeTrajectory();
+  MotionTrajectory prepared = makeTrajectory();
+  prepared.prepare();
+
+  for (size_t k = 0; k < plain.sampleCount(); k += 37) {
+    EXPECT_DOUBLE_EQ(plain.rotationAt(k), prepared.rotationAt(k)) << k;
+  }
+
+  // 복사본은 준비된 형상을 공유하고, 필드 변경은 그대로 반영된다
+  MotionTrajectory moved = prepared;
+  moved.startPosition = 3.0;
+  plain.startPosition = 3.0;
+  EXPECT_DOUBLE_EQ(plain.finalRotation(), moved.finalRotation());
+  moved.prepare();
+  EXPECT_DOUBLE_EQ(plain.finalRotation(), moved.finalRotation());
+}
+
+// Phase 13.2: 배열 경로와의 일치
+TEST(MotionTrajectoryTest, MatchesSampledVelocityProfileFromMover) {
+  // 궤적에서 평가한 속도는 SAMPLED 모드의 속도 프로파일과 일치한다
+  const RollWireMover::QuantizationMode modes[] = {
+      RollWireMover::QuantizationMode::ROUNDED,
+      RollWireMover::QuantizationMode::EXACT_DISTANCE};
+
+  for (RollWireMover::QuantizationMode mode : modes) {
+    SimMotor sampledMotor;
+    SimMotor parametricMotor;
+    RollWireMover::ErrorCode error;
+    RollWireMover sampled(1.0, 50.0, &sampledMotor, error);
+    RollWireMover parametric(1.0, 50.0, &parametricMotor, error);
+    for (RollWireMover *mover : {&sampled, &parametric}) {
+      mover->setQuantizationMode(mode);
+      mover->setAccelerationTime(0.12);
+      mover->setConstantVelocity(0.4);
+      mover->setDecelerationTime(0.18);
+    }
+    parametric.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+
+    sampled.moveRelative(0.75);
+    parametric.moveRelative(0.75);
+
+    const std::vector<double> &profile = sampled.getLastVelocityProfile();
+    const MotionTrajectory &trajectory = parametric.getLastTrajectory();
+    ASSERT_EQ(profile.size(), trajectory.sampleCount());
+    for (size_t k = 0; k < profile.size(); ++k) {
+      EXPECT_NEAR(profile[k], trajectory.velocityAt(k), 1e-12);
+    }
+    EXPECT_NEAR(sampledMotor.getCurrentRotation(),
+                parametricMotor.getCurrentRotation(), 1e-9);
+  }
+}
+
+// Phase 29.1: 수치 형식별 궤적 평가
+TEST(MotionTrajectoryTest, DoubleKernelMatchesRotationAt) {
+  // double 커널은 rotationAt()과 같은 회전량 샘플을 만든다
+  MotionTrajectory trajectory = makeTrajectory();
+  std::vector<double> rotations(trajectory.sampleCount());
+
+  ASSERT_EQ(rotations.size(),
+            sampleTrajectoryRotations(trajectory, rotations.data(),
+                                      rotations.size()));
+  for (size_t k = 0; k < rotations.size(); ++k) {
+    ASSERT_NEAR(trajectory.rotationAt(k), rotations[k], 1e-9)
+        << "at sample " << k;
+  }
+}
+
+TEST(MotionTrajectoryTest, FixedAndFloatKernelsStayWithinErrorBounds) {
+  // 내림/올림 모두 Fixed32는 1e-3도, float는 1e-2도 이내로 일치한다
+  for (double direction : {1.0, -1.0}) {
+    MotionTrajectory trajectory = makeTrajectory();
+    trajectory.direction = direction;
+    size_t count = trajectory.sampleCount();
+    std::vector<Fixed32> fixedRotations(count);
+    std::vector<float> floatRotations(count);
+    sampleTrajectoryRotations(trajectory, fixedRotations.data(), count);
+    sampleTrajectoryRotations(trajectory, floatRotations.data(), count);
+
+    for (size_t k = 0; k < count; ++k) {
+      double expected = trajectory.rotationAt(k);
+      ASSERT_NEAR(expected, static_cast<double>(fixedRotations[k]), 1e-3)
+          << "at sample " << k;
+      ASSERT_NEAR(expected, floatRotations[k], 1e-2) << "at sample " << k;
+    }
+  }
+}
+
+TEST(MotionTrajectoryTest, FixedKernelFollowsMoverTrajectory) {
+  // 이동기가 만든 궤적을 고정소수점으로 평가해도 최종 회전량이 맞고,
+  // 같은 궤적은 항상 같은 원시 값을 낸다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.moveTo(1.5);
+
+  const MotionTrajectory &trajectory = mover.getLastTrajectory();
+  size_t count = trajectory.sampleCount();
+  std::vector<Fixed32> first(count);
+  std::vector<Fixed32> second(count);
+  sampleTrajectoryRotations(trajectory, first.data(), count);
+  sampleTrajectoryRotations(trajectory, second.data(), count);
+
+  EXPECT_NEAR(simMotor.getCurrentRotation(),
+              static_cast<double>(first.back()), 1e-3);
+  for (size_t k = 0; k < count; ++k) {
+    ASSERT_EQ(first[k].getRaw(), second[k].getRaw());
+  }
+}
+
+TEST(MotionTrajectoryTest, KernelStopsAtCapacity) {
+  MotionTrajectory trajectory = makeTrajectory();
+  double rotations[10];
+
+  EXPECT_EQ(10u, sampleTrajectoryRotations(trajectory, rotations, 10));
+  EXPECT_NEAR(trajectory.rotationAt(9), rotations[9], 1e-9);
+}
@@ -0,0 +1,144 @@
+#include "MotorDynamics.h"
+#include "SimMotor.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+// Phase 16.1: MotorDynamicsBank
+TEST(MotorDynamicsTest, AddAxisStartsAtRestAtInitialRotation) {
+  // 추가한 축은 초기 회전량에서 정지 상태로 시작한다
+  MotorDynamicsBank bank;
+
+  EXPECT_EQ(0u, bank.addAxis(0.0));
+  EXPECT_EQ(1u, bank.addAxis(90.0));
+  EXPECT_EQ(2u, bank.size());
+  EXPECT_DOUBLE_EQ(90.0, bank.getRotation(1));
+  EXPECT_DOUBLE_EQ(0.0, bank.getVelocity(1));
+}
+
+TEST(MotorDynamicsTest, HoldsPositionForConstantSetpoint) {
+  // 목표값이 일정하면 위치를 유지한다
+  MotorDynamicsBank bank;
+  bank.addAxis(45.0);
+
+  for (int i = 0; i < 1000; ++i) {
+    bank.advanceAxis(0, 45.0, 0.001);
+  }
+
+  EXPECT_NEAR(45.0, bank.getRotation(0), 1e-9);
+  EXPECT_NEAR(0.0, bank.getFollowingErrorStats(0).maxAbsError, 1e-9);
+}
+
+TEST(MotorDynamicsTest, TracksSmoothRampWithSmallFollowingError) {
+  // 완만한 램프 목표를 작은 추종 오차로 따라간다
+  MotorDynamicsBank bank;
+  bank.addAxis(0.0);
+
+  // 0 → 360도/초 가속 후 등속 (1초)
+  double setpoint = 0.0;
+  for (int i = 0; i < 1000; ++i) {
+    double velocity = std::min(1.0, i / 200.0) * 360.0;
+    setpoint += velocity * 0.001;
+    bank.advanceAxis(0, setpoint, 0.001);
+  }
+
+  FollowingErrorStats stats = bank.getFollowingErrorStats(0);
+  EXPECT_EQ(1000u, stats.samples);
+  EXPECT_GT(stats.maxAbsError, 0.0);
+  EXPECT_LT(stats.maxAbsError, 1.0);
+  EXPECT_LE(stats.rmsError, stats.maxAbsError);
+}
+
+TEST(MotorDynamicsTest, TorqueSaturationIncreasesFollowingError) {
+  // 토크 한계가 낮으면 같은 목표에 대해 추종 오차가 커진다
+  MotorDynamicsParams strong;
+  MotorDynamicsParams weak;
+  weak.maxTorque = 0.05;
+  MotorDynamicsBank strongBank(strong);
+  MotorDynamicsBank weakBank(weak);
+  strongBank.addAxis(0.0);
+  weakBank.addAxis(0.0);
+
+  double setpoint = 0.0;
+  for (int i = 0; i < 500; ++i) {
+    setpoint += 720.0 * 0.001;
+    strongBank.advanceAxis(0, setpoint, 0.001);
+    weakBank.advanceAxis(0, setpoint, 0.001);
+  }
+
+  EXPECT_LE(std::abs(weakBank.getTorque(0)), weak.maxTorque);
+  EXPECT_GT(weakBank.getFollowingErrorStats(0).maxAbsError,
+            10.0 * strongBank.getFollowingErrorStats(0).maxAbsError);
+}
+
+TEST(MotorDynamicsTest, InertiaGrowsWithWoundWire) {
+  // 롤 관성은 감긴 와이어 양(회전량 0도 = 완전히 감김)에 비례한다
+  MotorDynamicsParams params;
+  params.wireInertiaPerTurn = 0.001;
+  params.fullyWoundTurns = 100.0;
+  MotorDynamicsBank bank(params);
+  bank.addAxis(0.0);         // 100바퀴 감김
+  bank.addAxis(360.0 * 50);  // 50바퀴 감김
+  bank.addAxis(360.0 * 200); // 모두 풀림
+
+  double base = params.motorInertia + params.spoolInertia;
+  EXPECT_NEAR(base + 0.1, bank.getInertia(0), 1e-12);
+  EXPECT_NEAR(base + 0.05, bank.getInertia(1), 1e-12);
+  EXPECT_NEAR(base, bank.getInertia(2), 1e-12);
+}
+
+TEST(MotorDynamicsTest, BatchAdvanceMatchesPerAxisAdvance) {
+  // 전체 축 일괄 적분 결과는 축별 적분 결과와 같다
+  MotorDynamicsBank batch;
+  MotorDynamicsBank single;
+  for (int axis = 0; axis < 8; ++axis) {
+    batch.addAxis(axis * 10.0);
+    single.addAxis(axis * 10.0);
+  }
+
+  std::vector<double> setpoints(8);
+  for (int step = 1; step <= 100; ++step) {
+    for (int axis = 0; axis < 8; ++axis) {
+      setpoints[axis] = axis * 10.0 + step * 0.1 * (axis + 1);
+      single.advanceAxis(axis, setpoints[axis], 0.001);
+    }
+    batch.advance(setpoints.data(), 0.001);
+  }
+
+  for (int axis = 0; axis < 8; ++axis) {
+    EXPECT_DOUBLE_EQ(single.getRotation(axis), batch.getRotation(axis));
+  }
+}
+
+// Phase 16.2: SimMotor 동역학 모드
+TEST(MotorDynamicsTest, SimMotorDynamicsAreDisabledByDefault) {
+  // 기본 SimMotor는 동역학 모델 없이 목표 회전량으로 바로 이동한다
+  SimMotor simMotor;
+
+  EXPECT_FALSE(simMotor.isDynamicsEnabled());
+  EXPECT_EQ(0u, simMotor.getFollowingErrorStats().samples);
+}
+
+TEST(MotorDynamicsTest, SimMotorWithDynamicsReportsFollowingError) {
+  // 동역학 모드에서는 각 샘플을 적분하고 추종 오차를 집계한다
+  SimMotor simMotor;
+  simMotor.enableDynamics(MotorDynamicsParams());
+
+  std::vector<double> profile;
+  double rotation = 0.0;
+  for (int i = 0; i < 2000; ++i) {
+    rotation += std::min(1.0, i / 300.0) * 180.0 * 0.001;
+    profile.push_back(rotation);
+  }
+  // 정지 후 정착 시간
+  profile.insert(profile.end(), 500, rotation);
+
+  simMotor.executeRotationProfile(profile);
+
+  FollowingErrorStats stats = simMotor.getFollowingErrorStats();
+  EXPECT_EQ(profile.size(), stats.samples);
+  EXPECT_GT(stats.maxAbsError, 0.0);
+  EXPECT_FALSE(simMotor.isRunning());
+  EXPECT_NEAR(rotation, simMotor.getCurrentRotation(), 0.01);
+}
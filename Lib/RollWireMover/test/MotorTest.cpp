@@ -13,3 +13,53 @@ TEST(MotorTest, MotorHasVirtualDestructor) {
     // Motor는 가상 소멸자를 가지고 있다
     EXPECT_TRUE(std::has_virtual_destructor<Motor>::value);
 }
+
+// Phase 13.3: 매개변수 궤적 기본 구현
+namespace {
+class RecordingMotor : public Motor {
+public:
+    void executeRotationProfile(const std::vector<double>& rotations) override {
+        received = rotations;
+    }
+    void stop() override {}
+    double getCurrentRotation() const override { return 0.0; }
+    bool isRunning() const override { return false; }
+    void resetPosition() override {}
+
+    std::vector<double> received;
+};
+} // namespace
+
+TEST(MotorTest, DefaultExecuteTrajectoryExpandsToRotationProfile) {
+    // 온보드 프로파일을 지원하지 않는 모터는 궤적을 회전량 배열로 전개하여 받는다
+    MotionTrajectory trajectory;
+    trajectory.accSteps = 10;
+    trajectory.constSteps = 5;
+    trajectory.decSteps = 10;
+    trajectory.peakVelocity = 0.1;
+    trajectory.accRampTime = 0.01;
+    trajectory.decRampTime = 0.01;
+    trajectory.innerRadius = 50.0;
+
+    RecordingMotor motor;
+    Motor &base = motor;
+    base.executeTrajectory(trajectory);
+
+    ASSERT_EQ(trajectory.sampleCount(), motor.received.size());
+    for (size_t k = 0; k < motor.received.size(); ++k) {
+        EXPECT_DOUBLE_EQ(trajectory.rotationAt(k), motor.received[k]);
+    }
+}
+
+TEST(MotorTest, DefaultRvalueAndSharedOverloadsForwardToConstReference) {
+    // 재정의하지 않은 rvalue/shared_ptr 오버로드는 const& 버전으로 전달된다
+    RecordingMotor motor;
+    Motor &base = motor;
+
+    base.executeRotationProfile(std::vector<double>{1.0, 2.0});
+    EXPECT_EQ(2u, motor.received.size());
+
+    base.executeRotationProfile(std::make_shared<const std::vector<double>>(
+        std::vector<double>{3.0, 4.0, 5.0}));
+    EXPECT_EQ(3u, motor.received.size());
+}
@@ -0,0 +1,156 @@
+#include "AsyncMover.h"
+#include "MoveScheduler.h"
+#include "SimMotor.h"
+#include "SimMotorBank.h"
+#include "SpoolGeometry.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+MoveTask delayTask(MoveScheduler &scheduler, double seconds,
+                   uint64_t &resumedAt) {
+  co_await scheduler.delay(seconds);
+  resumedAt = scheduler.getTick();
+}
+
+MoveTask moveTask(AsyncMover &axis, double target,
+                  RollWireMover::ErrorCode &result, uint64_t &finishedAt,
+                  MoveScheduler &scheduler) {
+  result = co_await axis.moveTo(target);
+  finishedAt = scheduler.getTick();
+}
+
+// 하위 시퀀스: 내려간 뒤 대기
+MoveTask lowerAndHold(AsyncMover &axis, double target, double seconds) {
+  co_await axis.moveTo(target);
+  co_await axis.dwell(seconds);
+}
+
+MoveTask cycleTask(AsyncMover &axis, double target, int &completed) {
+  co_await lowerAndHold(axis, target, 0.05);
+  co_await axis.moveTo(0.0);
+  completed++;
+}
+
+MoveTask failingTask(MoveScheduler &scheduler) {
+  co_await scheduler.delay(0.002);
+  throw std::runtime_error("sequence failed");
+}
+
+} // namespace
+
+// Phase 23.1: 스케줄러 기본 동작
+TEST(MoveSchedulerTest, DelayResumesAfterRoundedTicks) {
+  // delay()는 제어 주기 단위로 반올림한 주기 수만큼 기다린다
+  int clockCalls = 0;
+  MoveScheduler scheduler(0.001, [&] { clockCalls++; });
+  uint64_t resumedAt = 0;
+
+  scheduler.spawn(delayTask(scheduler, 0.0104, resumedAt));
+  EXPECT_EQ(1u, scheduler.getActiveTaskCount());
+  EXPECT_EQ(1u, scheduler.getWaitingCount());
+
+  EXPECT_EQ(10u, scheduler.runUntilIdle());
+  EXPECT_EQ(10u, resumedAt);
+  EXPECT_EQ(10, clockCalls);
+  EXPECT_EQ(0u, scheduler.getActiveTaskCount());
+  EXPECT_NEAR(0.010, scheduler.getElapsedTime(), 1e-12);
+}
+
+TEST(MoveSchedulerTest, ZeroDelayDoesNotSuspend) {
+  MoveScheduler scheduler(0.001, [] {});
+  uint64_t resumedAt = 99;
+
+  scheduler.spawn(delayTask(scheduler, 0.0, resumedAt));
+
+  EXPECT_EQ(0u, resumedAt);
+  EXPECT_EQ(0u, scheduler.getActiveTaskCount());
+}
+
+// Phase 23.2: co_await 이동 명령
+TEST(MoveSchedulerTest, MoveToResumesWhenMotorStops) {
+  // 모터 클록으로 진행하며, 프로파일이 끝나는 주기에 재개한다
+  SimMotorBank bank;
+  bank.addMotor();
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &bank.motor(0), error);
+  mover.setConstantVelocity(0.5);
+  MoveScheduler scheduler(bank.getControlPeriod(), [&] { bank.stepAll(); });
+  AsyncMover axis(mover, bank.motor(0), scheduler);
+
+  RollWireMover::ErrorCode result = RollWireMover::ErrorCode::MOTOR_BUSY;
+  uint64_t finishedAt = 0;
+  scheduler.spawn(moveTask(axis, 1.0, result, finishedAt, scheduler));
+  EXPECT_TRUE(bank.isRunning(0));
+
+  scheduler.runUntilIdle();
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, result);
+  EXPECT_EQ(mover.getLastVelocityProfile().size(), finishedAt);
+
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(1.0), bank.getCurrentRotation(0), 0.1);
+}
+
+TEST(MoveSchedulerTest, ImmediateMotorAndRejectedMoveDoNotSuspend) {
+  // 즉시 완료 모터와 검증 실패 이동은 중단 없이 결과를 돌려준다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  MoveScheduler scheduler(0.001, [] {});
+  AsyncMover axis(mover, simMotor, scheduler);
+
+  RollWireMover::ErrorCode result = RollWireMover::ErrorCode::MOTOR_BUSY;
+  uint64_t finishedAt = 99;
+  scheduler.spawn(moveTask(axis, 1.0, result, finishedAt, scheduler));
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, result);
+  EXPECT_EQ(0u, finishedAt);
+
+  scheduler.spawn(moveTask(axis, 9.0, result, finishedAt, scheduler));
+  EXPECT_EQ(RollWireMover::ErrorCode::OUT_OF_RANGE, result);
+  EXPECT_EQ(0u, scheduler.getActiveTaskCount());
+}
+
+TEST(MoveSchedulerTest, ManyAxesRunNestedSequencesOnOneThread) {
+  // 축마다 스레드 없이 여러 이동 시퀀스를 동시에 진행한다
+  const size_t AXES = 64;
+  SimMotorBank bank;
+  std::vector<std::unique_ptr<RollWireMover>> movers;
+  std::vector<std::unique_ptr<AsyncMover>> axes;
+  MoveScheduler scheduler(bank.getControlPeriod(), [&] { bank.stepAll(); });
+  for (size_t i = 0; i < AXES; i++) {
+    size_t index = bank.addMotor();
+    RollWireMover::ErrorCode error;
+    movers.push_back(std::make_unique<RollWireMover>(1.0, 50.0,
+                                                     &bank.motor(index), error));
+    movers.back()->setConstantVelocity(0.5);
+    axes.push_back(
+        std::make_unique<AsyncMover>(*movers.back(), bank.motor(index), scheduler));
+  }
+
+  int completed = 0;
+  for (size_t i = 0; i < AXES; i++) {
+    scheduler.spawn(cycleTask(*axes[i], 0.1 + 0.01 * i, completed));
+  }
+  EXPECT_EQ(AXES, scheduler.getActiveTaskCount());
+
+  scheduler.runUntilIdle();
+  EXPECT_EQ(static_cast<int>(AXES), completed);
+  EXPECT_EQ(0u, scheduler.getActiveTaskCount());
+  for (size_t i = 0; i < AXES; i++) {
+    EXPECT_NEAR(0.0, bank.getCurrentRotation(i), 0.1);
+  }
+  // 축마다 이동 2번 + 대기 1번 재개 (spawn 시 첫 실행 포함)
+  EXPECT_EQ(AXES * 4, scheduler.getResumeCount());
+}
+
+TEST(MoveSchedulerTest, TaskExceptionPropagatesFromStep) {
+  MoveScheduler scheduler(0.001, [] {});
+  scheduler.spawn(failingTask(scheduler));
+
+  scheduler.step();
+  EXPECT_THROW(scheduler.step(), std::runtime_error);
+  EXPECT_EQ(0u, scheduler.getActiveTaskCount());
+}
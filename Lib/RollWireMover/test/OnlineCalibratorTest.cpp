@@ -0,0 +1,141 @@
+#include "OnlineCalibrator.h"
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include "SpoolGeometry.h"
+#include <atomic>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+
+namespace {
+
+// 실제 롤에서 위치 s의 (측정 위치, 모두 감긴 상태 기준 회전량) 표본 반영
+void feed(OnlineCalibrator &calibrator, const SpoolGeometry &actual,
+          double position) {
+  calibrator.addSample(position, actual.rotationAtPosition(position));
+}
+
+} // namespace
+
+// Phase 28.1: 재귀 최소제곱 추정
+TEST(OnlineCalibratorTest, ConvergesFromNominalToActualGeometry) {
+  // 공칭 형상에서 시작해 실제 롤의 두께/내경으로 수렴한다
+  SpoolGeometry actual(1.08, 46.0, 5.0);
+  OnlineCalibrator calibrator(1.0, 50.0, 5.0);
+  EXPECT_DOUBLE_EQ(1.0, calibrator.getEstimate().wireThickness);
+  EXPECT_EQ(1u, calibrator.getVersion());
+
+  for (int i = 1; i <= 20; i++) {
+    feed(calibrator, actual, 0.25 * i);
+  }
+
+  OnlineCalibrator::Estimate estimate = calibrator.getEstimate();
+  EXPECT_NEAR(1.08, estimate.wireThickness, 1e-6);
+  EXPECT_NEAR(46.0, estimate.innerRadius, 1e-4);
+  EXPECT_EQ(20u, estimate.samples);
+  EXPECT_NEAR(0.0, estimate.residual, 1e-9);
+}
+
+TEST(OnlineCalibratorTest, ForgettingFactorTracksChangingWire) {
+  // 망각 계수가 1보다 작으면 새 로트의 와이어로 추정이 옮겨 간다
+  SpoolGeometry firstLot(1.0, 50.0, 5.0);
+  SpoolGeometry secondLot(1.1, 50.0, 5.0);
+  OnlineCalibrator calibrator(1.0, 50.0, 5.0, 0.9);
+
+  for (int i = 1; i <= 20; i++) {
+    feed(calibrator, firstLot, 0.2 * i);
+  }
+  EXPECT_NEAR(1.0, calibrator.getEstimate().wireThickness, 1e-6);
+  for (int cycle = 0; cycle < 5; cycle++) {
+    for (int i = 1; i <= 20; i++) {
+      feed(calibrator, secondLot, 0.2 * i);
+    }
+  }
+  EXPECT_NEAR(1.1, calibrator.getEstimate().wireThickness, 1e-4);
+}
+
+TEST(OnlineCalibratorTest, InvalidSamplesAreNotPublished) {
+  OnlineCalibrator calibrator(1.0, 50.0, 5.0);
+  uint64_t version = calibrator.getVersion();
+
+  EXPECT_FALSE(calibrator.addSample(1.0, -10.0));
+  EXPECT_FALSE(calibrator.addSample(NAN, 100.0));
+  EXPECT_EQ(version, calibrator.getVersion());
+  EXPECT_EQ(0u, calibrator.getEstimate().samples);
+}
+
+// Phase 28.2: 이동 파이프라인 연동
+TEST(OnlineCalibratorTest, MoverPicksUpEstimateAndReducesPositionError) {
+  // 공칭 형상(1.0mm, 50mm)으로 설정한 이동기가 실제 롤(1.05mm, 47mm)의
+  // 측정 위치로 보정되면 명령 위치와 실제 위치의 차이가 줄어든다
+  SpoolGeometry actual(1.05, 47.0, 5.0);
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  auto calibrator = std::make_shared<OnlineCalibrator>(1.0, 50.0, 5.0);
+
+  mover.moveTo(2.0);
+  double uncalibratedError =
+      std::abs(actual.positionAtRotation(simMotor.getCurrentRotation()) - 2.0);
+
+  mover.setOnlineCalibrator(calibrator);
+  for (double target : {0.5, 1.5, 3.0, 4.5}) {
+    mover.moveTo(target);
+    EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+              mover.recordMeasuredPosition(
+                  actual.positionAtRotation(simMotor.getCurrentRotation())));
+  }
+
+  mover.moveTo(2.0);
+  double calibratedError =
+      std::abs(actual.positionAtRotation(simMotor.getCurrentRotation()) - 2.0);
+  EXPECT_NEAR(1.05, mover.getMotionConfig()->wireThickness, 1e-3);
+  EXPECT_NEAR(47.0, mover.getInnerRadius(), 0.1);
+  EXPECT_GT(uncalibratedError, 0.01);
+  EXPECT_LT(calibratedError, 1e-3);
+}
+
+TEST(OnlineCalibratorTest, RecordRequiresCalibratorAndStoppedMotor) {
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::CALIBRATOR_NOT_SET,
+            mover.recordMeasuredPosition(0.0));
+  mover.setOnlineCalibrator(
+      std::make_shared<OnlineCalibrator>(1.0, 50.0, 5.0));
+  mover.moveTo(0.5);
+  EXPECT_EQ(RollWireMover::ErrorCode::MOTOR_BUSY,
+            mover.recordMeasuredPosition(0.25));
+}
+
+TEST(OnlineCalibratorTest, BackgroundUpdatesWhileMoving) {
+  // 다른 스레드가 표본을 반영하는 동안 이동 명령이 추정값을 안전하게 읽는다
+  SpoolGeometry actual(1.05, 47.0, 5.0);
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  auto calibrator = std::make_shared<OnlineCalibrator>(1.0, 50.0, 5.0);
+  mover.setOnlineCalibrator(calibrator);
+
+  std::atomic<bool> done(false);
+  std::thread sensor([&] {
+    int i = 0;
+    while (!done.load()) {
+      feed(*calibrator, actual, 0.1 + 0.01 * (i++ % 400));
+    }
+  });
+  for (int i = 0; i < 200; i++) {
+    EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+              mover.moveTo(i % 2 == 0 ? 1.0 : 3.0));
+  }
+  done = true;
+  sensor.join();
+
+  mover.moveTo(2.0);
+  EXPECT_NEAR(1.05, mover.getMotionConfig()->wireThickness, 1e-3);
+  EXPECT_NEAR(2.0, actual.positionAtRotation(simMotor.getCurrentRotation()),
+              1e-3);
+}
@@ -0,0 +1,153 @@
+#include "PlantSimulator.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+PlantSimulator::Config makeConfig(size_t axisCount) {
+  PlantSimulator::Config config;
+  config.axisCount = axisCount;
+  config.threadCount = 1;
+  return config;
+}
+
+PlantEvent makeEvent(double time, size_t axis, PlantEvent::Type type,
+                     double value = 0.0) {
+  PlantEvent event;
+  event.time = time;
+  event.axis = axis;
+  event.type = type;
+  event.value = value;
+  return event;
+}
+
+} // namespace
+
+// Phase 18.1: 설정 및 이벤트 등록
+TEST(PlantSimulatorTest, ConstructorRejectsZeroAxes) {
+  // 축 수가 0이면 INVALID_AXIS_COUNT를 반환한다
+  PlantSimulator::ErrorCode error;
+  PlantSimulator simulator(makeConfig(0), error);
+
+  EXPECT_EQ(PlantSimulator::ErrorCode::INVALID_AXIS_COUNT, error);
+}
+
+TEST(PlantSimulatorTest, ConstructorRejectsSettingsOutsideMoverRanges) {
+  // 이동기가 받아들이지 않는 속도/제어 주기는 INVALID_PARAMETER를 반환한다
+  PlantSimulator::Config config = makeConfig(1);
+  config.constantVelocity = 2.0; // MAX_VELOCITY(1.0) 초과
+  PlantSimulator::ErrorCode error;
+  PlantSimulator fast(config, error);
+  EXPECT_EQ(PlantSimulator::ErrorCode::INVALID_PARAMETER, error);
+
+  config = makeConfig(1);
+  config.controlPeriod = 0.5; // MAX_CONTROL_PERIOD(0.1) 초과
+  PlantSimulator slow(config, error);
+  EXPECT_EQ(PlantSimulator::ErrorCode::INVALID_PARAMETER, error);
+}
+
+TEST(PlantSimulatorTest, ScheduleValidatesAxisAndTime) {
+  // 존재하지 않는 축이나 음수 시각의 이벤트는 거부한다
+  PlantSimulator::ErrorCode error;
+  PlantSimulator simulator(makeConfig(2), error);
+  ASSERT_EQ(PlantSimulator::ErrorCode::SUCCESS, error);
+
+  EXPECT_EQ(PlantSimulator::ErrorCode::INVALID_AXIS,
+            simulator.schedule(makeEvent(0.0, 2, PlantEvent::Type::STOP)));
+  EXPECT_EQ(PlantSimulator::ErrorCode::INVALID_TIME,
+            simulator.schedule(makeEvent(-1.0, 0, PlantEvent::Type::STOP)));
+  EXPECT_EQ(PlantSimulator::ErrorCode::SUCCESS,
+            simulator.schedule(makeEvent(0.0, 1, PlantEvent::Type::STOP)));
+  EXPECT_EQ(1u, simulator.getScheduledEventCount());
+}
+
+// Phase 18.2: 이산 사건 처리
+TEST(PlantSimulatorTest, SingleMoveCompletesAndReportsBusyTime) {
+  // 단일 이동은 궤적 시간만큼 축을 점유하고 목표 위치에서 끝난다
+  PlantSimulator::ErrorCode error;
+  PlantSimulator simulator(makeConfig(1), error);
+  simulator.schedule(makeEvent(1.0, 0, PlantEvent::Type::MOVE_TO, 1.0));
+
+  PlantReport report = simulator.run();
+
+  const AxisReport &axis = report.axes[0];
+  EXPECT_EQ(1u, axis.movesCompleted);
+  EXPECT_NEAR(1.0, axis.finalPosition, 1e-9);
+  // 1m / 0.1m/s ≈ 10초 + 가감속
+  EXPECT_GT(axis.busyTime, 10.0);
+  EXPECT_LT(axis.busyTime, 10.5);
+  EXPECT_DOUBLE_EQ(1.0 + axis.busyTime, report.cycleTime);
+}
+
+TEST(PlantSimulatorTest, CommandsDuringMoveAreDeferred) {
+  // 이동 중 도착한 이동 명령은 이전 이동 완료 후 실행된다
+  PlantSimulator::ErrorCode error;
+  PlantSimulator simulator(makeConfig(1), error);
+  simulator.schedule(makeEvent(0.0, 0, PlantEvent::Type::MOVE_TO, 1.0));
+  simulator.schedule(makeEvent(2.0, 0, PlantEvent::Type::MOVE_TO, 0.5));
+
+  PlantReport report = simulator.run();
+
+  const AxisReport &axis = report.axes[0];
+  EXPECT_EQ(1u, axis.deferredEvents);
+  EXPECT_EQ(2u, axis.movesCompleted);
+  EXPECT_NEAR(0.5, axis.finalPosition, 1e-9);
+  EXPECT_NEAR(axis.busyTime, report.cycleTime, 1e-9);
+}
+
+TEST(PlantSimulatorTest, StopInterruptsMoveAtCurrentPosition) {
+  // STOP은 진행 중인 이동을 중단하고 그 시점의 위치를 유지한다
+  PlantSimulator::ErrorCode error;
+  PlantSimulator simulator(makeConfig(1), error);
+  simulator.schedule(makeEvent(0.0, 0, PlantEvent::Type::MOVE_TO, 2.0));
+  simulator.schedule(makeEvent(5.0, 0, PlantEvent::Type::STOP));
+
+  PlantReport report = simulator.run();
+
+  const AxisReport &axis = report.axes[0];
+  EXPECT_EQ(1u, axis.movesStopped);
+  EXPECT_EQ(0u, axis.movesCompleted);
+  EXPECT_DOUBLE_EQ(5.0, axis.busyTime);
+  // 5초 동안 약 0.5m 이동 (가속 구간 손실 포함)
+  EXPECT_NEAR(0.495, axis.finalPosition, 0.002);
+}
+
+// Phase 18.3: 결정적 병렬 실행
+TEST(PlantSimulatorTest, ShiftScheduleIsDeterministicAcrossThreadCounts) {
+  // 같은 시드는 스레드 수와 무관하게 같은 결과를 낸다
+  PlantSimulator::Config config = makeConfig(8);
+  PlantSimulator::ErrorCode error;
+  PlantSimulator serial(config, error);
+  config.threadCount = 4;
+  PlantSimulator parallel(config, error);
+
+  serial.scheduleShift(4 * 3600.0, 60.0, 42);
+  parallel.scheduleShift(4 * 3600.0, 60.0, 42);
+  EXPECT_EQ(serial.getScheduledEventCount(),
+            parallel.getScheduledEventCount());
+
+  PlantReport a = serial.run();
+  PlantReport b = parallel.run();
+
+  EXPECT_GT(a.totalMoves, 0u);
+  EXPECT_EQ(a.totalEvents, b.totalEvents);
+  EXPECT_EQ(a.totalMoves, b.totalMoves);
+  EXPECT_DOUBLE_EQ(a.cycleTime, b.cycleTime);
+  for (size_t i = 0; i < a.axes.size(); ++i) {
+    EXPECT_DOUBLE_EQ(a.axes[i].busyTime, b.axes[i].busyTime);
+    EXPECT_DOUBLE_EQ(a.axes[i].finalPosition, b.axes[i].finalPosition);
+    EXPECT_GT(a.axes[i].utilization, 0.0);
+    EXPECT_LE(a.axes[i].utilization, 1.0);
+  }
+}
+
+TEST(PlantSimulatorTest, DifferentSeedsProduceDifferentSchedules) {
+  // 시드가 다르면 다른 스케줄이 생성된다
+  PlantSimulator::ErrorCode error;
+  PlantSimulator first(makeConfig(1), error);
+  PlantSimulator second(makeConfig(1), error);
+
+  first.scheduleShift(3600.0, 30.0, 1);
+  second.scheduleShift(3600.0, 30.0, 2);
+
+  EXPECT_NE(first.run().axes[0].busyTime, second.run().axes[0].busyTime);
+}
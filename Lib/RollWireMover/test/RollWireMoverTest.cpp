@@ -1,6 +1,12 @@
 #include "RollWireMover.h"
 #include "SimMotor.h"
+#include "SpoolGeometry.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 // Phase 2.1: 클래스 생성 및 초기화 (의존성 주입)
 TEST(RollWireMoverTest, CanCreateRollWireMover) {
@@ -110,6 +116,40 @@ TEST(RollWireMoverTest, ConstructorReturnsSuccessWhenAllParametersValid) {
   EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, error);
 }
 
+TEST(RollWireMoverTest, SettersAfterFailedConstructionReturnConstructionError) {
+  // 생성 검증에 실패한 이동기의 설정 메서드는 생성 에러를 반환하고,
+  // 조회 메서드는 기본값을 반환한다 (설정이 게시되지 않아도 안전)
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover noMotor(1.0, 50.0, nullptr, error);
+  RollWireMover badWire(0.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTOR_POINTER,
+            noMotor.setAccelerationTime(0.2));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTOR_POINTER,
+            noMotor.setControlPeriod(0.002));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTOR_POINTER,
+            noMotor.setInnerRadius(40.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_WIRE_THICKNESS,
+            badWire.setConstantVelocity(0.3));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_WIRE_THICKNESS,
+            badWire.setMaxWireLength(3.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_WIRE_THICKNESS,
+            badWire.setMotorLimits(100.0, 720.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_WIRE_THICKNESS,
+            badWire.setMotionConfig(nullptr));
+  EXPECT_EQ(nullptr,
+            badWire.makeMotionConfig(RollWireMover::MotionSettings(), error));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_WIRE_THICKNESS, error);
+
+  badWire.setVelocityProfile(RollWireMover::ProfileType::S_CURVE);
+  badWire.setPlanningSpace(RollWireMover::PlanningSpace::ROTATION);
+  EXPECT_DOUBLE_EQ(0.001, badWire.getControlPeriod());
+  EXPECT_EQ(RollWireMover::PlanningSpace::WIRE, badWire.getPlanningSpace());
+  EXPECT_DOUBLE_EQ(0.0, badWire.getInnerRadius());
+  EXPECT_EQ(nullptr, badWire.getMotionConfig());
+}
+
 // Phase 2.2: 초기 상태
 TEST(RollWireMoverTest, InitialPositionIsZero) {
   // 초기 현재 위치는 0이다 (완전히 올린 상태)
@@ -1035,3 +1075,1187 @@ TEST(RollWireMoverTest, DecelerationPhaseTimeMatchesSetDecelerationTime) {
   EXPECT_NEAR(decelTime, actualDecelTime, 0.002); // ±2ms 허용 오차
 }
 
+
+// Phase 11: 정확한 거리 양자화 (EXACT_DISTANCE)
+TEST(RollWireMoverTest, DefaultQuantizationModeIsRounded) {
+  // 기본 양자화 방식은 ROUNDED이다 (기존 동작 유지)
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::QuantizationMode::ROUNDED,
+            mover.getQuantizationMode());
+
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  EXPECT_EQ(RollWireMover::QuantizationMode::EXACT_DISTANCE,
+            mover.getQuantizationMode());
+}
+
+TEST(RollWireMoverTest, ExactDistanceProfileIntegratesToRequestedDistance) {
+  // EXACT_DISTANCE 모드에서 1ms 이산 적분 거리는 요청 거리와 일치한다
+  // (정속 구간이 있는 경우와 삼각형 프로파일 모두)
+  const double distances[] = {0.0005, 0.01, 0.0333, 0.1234, 0.7777, 2.5001};
+
+  for (double distance : distances) {
+    SimMotor simMotor;
+    RollWireMover::ErrorCode error;
+    RollWireMover mover(1.0, 50.0, &simMotor, error);
+    mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+    mover.setAccelerationTime(0.1234);
+    mover.setConstantVelocity(0.37);
+    mover.setDecelerationTime(0.0777);
+
+    ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveRelative(distance));
+
+    const std::vector<double> &profile = mover.getLastVelocityProfile();
+    double integrated = 0.0;
+    for (double v : profile) {
+      integrated += v * 0.001;
+    }
+    EXPECT_NEAR(distance, integrated, 1e-12) << "distance " << distance;
+  }
+}
+
+TEST(RollWireMoverTest, ExactDistanceProfilePeakDoesNotExceedConstantVelocity) {
+  // 구간을 올림하므로 보정된 최고 속도는 constantVelocity 이하이다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  mover.setAccelerationTime(0.1005);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.2003);
+
+  mover.moveRelative(1.2345);
+
+  const std::vector<double> &profile = mover.getLastVelocityProfile();
+  ASSERT_FALSE(profile.empty());
+  EXPECT_DOUBLE_EQ(0.0, profile.front());
+  EXPECT_DOUBLE_EQ(0.0, profile.back());
+  for (double v : profile) {
+    EXPECT_LE(v, 0.5);
+  }
+}
+
+TEST(RollWireMoverTest, ExactDistancePhasesAreNotShorterThanConfigured) {
+  // 가속/감속 구간은 설정 시간보다 짧아지지 않는다 (최대 1샘플 연장)
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  mover.setAccelerationTime(0.1);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.1);
+
+  mover.moveRelative(0.2);
+
+  // 가속 100샘플 + 정속 300샘플 + 감속 100샘플 + 마지막 0
+  const std::vector<double> &profile = mover.getLastVelocityProfile();
+  EXPECT_EQ(501u, profile.size());
+  EXPECT_NEAR(0.5, profile[100], 1e-12);
+}
+
+TEST(RollWireMoverTest, ExactDistanceMoveRotatesMotorByExactDistance) {
+  // 모터의 최종 회전량은 요청 거리에 해당하는 회전량과 일치한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  mover.setAccelerationTime(0.15);
+  mover.setConstantVelocity(0.45);
+  mover.setDecelerationTime(0.25);
+
+  double distance = 1.3579;
+  mover.moveRelative(distance);
+
+  // 기본 최대 와이어 길이 5.0m 기준 롤 형상
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  double expectedRotation = spool.rotationAtPosition(distance);
+  EXPECT_NEAR(expectedRotation, simMotor.getCurrentRotation(), 1e-9);
+
+  // 되감기 후 원위치로 복귀한다
+  mover.moveTo(0.0);
+  EXPECT_NEAR(0.0, simMotor.getCurrentRotation(), 1e-9);
+}
+
+// Phase 12: 제어 주기 설정
+TEST(RollWireMoverTest, DefaultControlPeriodIs1ms) {
+  // 기본 제어 주기는 1ms이다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_DOUBLE_EQ(0.001, mover.getControlPeriod());
+}
+
+TEST(RollWireMoverTest, SetControlPeriodReturnsErrorWhenOutOfRange) {
+  // 0 이하 또는 MAX_CONTROL_PERIOD(0.1초) 초과 값은
+  // ErrorCode::INVALID_CONTROL_PERIOD를 반환하고 기존 값을 유지한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_CONTROL_PERIOD,
+            mover.setControlPeriod(0.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_CONTROL_PERIOD,
+            mover.setControlPeriod(-0.001));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_CONTROL_PERIOD,
+            mover.setControlPeriod(0.2));
+  EXPECT_DOUBLE_EQ(0.001, mover.getControlPeriod());
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setControlPeriod(0.004));
+  EXPECT_DOUBLE_EQ(0.004, mover.getControlPeriod());
+}
+
+TEST(RollWireMoverTest, ControlPeriodIsPropagatedToMotor) {
+  // 설정한 제어 주기는 모터에도 전달된다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  mover.setControlPeriod(0.00025);
+
+  EXPECT_DOUBLE_EQ(0.00025, simMotor.getControlPeriod());
+}
+
+TEST(RollWireMoverTest, SlowerControlPeriodProducesProportionallySmallerProfile) {
+  // 250Hz(4ms) 주기의 프로파일은 1kHz 대비 약 1/4 크기이다
+  SimMotor fastMotor;
+  SimMotor slowMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover fastMover(1.0, 50.0, &fastMotor, error);
+  RollWireMover slowMover(1.0, 50.0, &slowMotor, error);
+
+  for (RollWireMover *mover : {&fastMover, &slowMover}) {
+    mover->setAccelerationTime(0.2);
+    mover->setConstantVelocity(0.5);
+    mover->setDecelerationTime(0.2);
+  }
+  slowMover.setControlPeriod(0.004);
+
+  fastMover.moveRelative(1.0);
+  slowMover.moveRelative(1.0);
+
+  double fastSamples = fastMover.getLastVelocityProfile().size();
+  double slowSamples = slowMover.getLastVelocityProfile().size();
+  EXPECT_NEAR(4.0, fastSamples / slowSamples, 0.05);
+
+  // 실행 시간(샘플 수 × 주기)은 주기와 무관하게 같다
+  EXPECT_NEAR(fastMotor.getElapsedTime(), slowMotor.getElapsedTime(), 0.005);
+}
+
+TEST(RollWireMoverTest, ExactDistanceHoldsForFastControlPeriod) {
+  // 4kHz 주기에서도 EXACT_DISTANCE 이산 적분 거리는 요청 거리와 일치한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  mover.setControlPeriod(0.00025);
+  mover.setAccelerationTime(0.1);
+  mover.setConstantVelocity(0.3);
+  mover.setDecelerationTime(0.1);
+
+  mover.moveRelative(0.4321);
+
+  double integrated = 0.0;
+  for (double v : mover.getLastVelocityProfile()) {
+    integrated += v * 0.00025;
+  }
+  EXPECT_NEAR(0.4321, integrated, 1e-12);
+}
+
+// Phase 13: 매개변수 궤적 전달 (PARAMETRIC)
+TEST(RollWireMoverTest, DefaultTrajectoryModeIsSampled) {
+  // 기본 모터 전달 방식은 SAMPLED이다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::TrajectoryMode::SAMPLED, mover.getTrajectoryMode());
+}
+
+TEST(RollWireMoverTest, ParametricModeSendsTrajectoryInsteadOfSamples) {
+  // PARAMETRIC 모드에서는 샘플 배열 없이 궤적만 모터에 전달된다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.setAccelerationTime(0.1);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.1);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(2.0));
+
+  EXPECT_TRUE(simMotor.hasTrajectory());
+  EXPECT_TRUE(simMotor.getLastProfile().empty());
+  EXPECT_TRUE(mover.getLastVelocityProfile().empty());
+  EXPECT_DOUBLE_EQ(2.0, mover.getCurrentPosition());
+  EXPECT_DOUBLE_EQ(simMotor.getLastTrajectory().finalRotation(),
+                   simMotor.getCurrentRotation());
+}
+
+TEST(RollWireMoverTest, ParametricRoundTripReturnsToStartRotation) {
+  // PARAMETRIC 모드로 내렸다 올리면 시작 회전량으로 돌아온다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  mover.setAccelerationTime(0.1);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.1);
+
+  mover.moveTo(1.5);
+  EXPECT_GT(simMotor.getCurrentRotation(), 0.0);
+  EXPECT_EQ(1.0, simMotor.getLastTrajectory().direction);
+
+  mover.moveTo(0.0);
+  EXPECT_EQ(-1.0, simMotor.getLastTrajectory().direction);
+  EXPECT_NEAR(0.0, simMotor.getCurrentRotation(), 1e-9);
+}
+
+// Phase 15: 단계 실행 모터와의 연동
+TEST(RollWireMoverTest, SteppedMotorReachesTargetAfterRunUntilMoveDuration) {
+  // STEPPED 모드 SimMotor는 이동 시간만큼 진행한 후 목표 회전량에 도달한다
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.setAccelerationTime(0.2);
+  mover.setConstantVelocity(0.5);
+  mover.setDecelerationTime(0.2);
+
+  mover.moveTo(1.0);
+  const MotionTrajectory &trajectory = simMotor.getLastTrajectory();
+  EXPECT_TRUE(simMotor.isRunning());
+
+  simMotor.setTimeWarp(true);
+  simMotor.runUntil(trajectory.duration());
+
+  EXPECT_FALSE(simMotor.isRunning());
+  EXPECT_DOUBLE_EQ(trajectory.finalRotation(), simMotor.getCurrentRotation());
+}
+
+TEST(RollWireMoverTest, MoveCommandsWhileSteppedMotorRunsAreBusy) {
+  // 이전 이동이 실행 중이면 moveTo/moveRelative/executeQueue는 MOTOR_BUSY를
+  // 반환하고 위치 추적은 흐트러지지 않는다
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(2.0));
+  simMotor.stepN(simMotor.getLastProfile().size() / 2);
+  ASSERT_TRUE(simMotor.isRunning());
+
+  EXPECT_EQ(RollWireMover::ErrorCode::MOTOR_BUSY, mover.moveTo(1.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::MOTOR_BUSY, mover.moveRelative(-0.5));
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.queueMove(1.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::MOTOR_BUSY, mover.executeQueue());
+  EXPECT_EQ(1u, mover.getQueuedCount());
+
+  // 이전 이동을 끝낸 뒤에는 큐가 정상 실행되고 위치와 회전량이 일치한다
+  while (simMotor.stepN(1000) > 0) {
+  }
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executeQueue());
+  while (simMotor.stepN(1000) > 0) {
+  }
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(1.0, mover.getCurrentPosition(), 1e-12);
+  EXPECT_NEAR(spool.rotationAtPosition(1.0), simMotor.getCurrentRotation(),
+              1e-6);
+}
+
+// Phase 18: 이동 중단
+TEST(RollWireMoverTest, StopRecomputesPositionFromMotorRotation) {
+  // stop()은 모터를 멈추고 실제 회전량으로 현재 위치를 다시 계산한다
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  mover.moveTo(2.0);
+  simMotor.stepN(simMotor.getLastProfile().size() / 2);
+  mover.stop();
+
+  EXPECT_FALSE(simMotor.isRunning());
+  EXPECT_GT(mover.getCurrentPosition(), 0.9);
+  EXPECT_LT(mover.getCurrentPosition(), 1.1);
+
+  // 연속 호출해도 위치는 변하지 않는다
+  double position = mover.getCurrentPosition();
+  mover.stop();
+  EXPECT_DOUBLE_EQ(position, mover.getCurrentPosition());
+
+  // 이후 이동은 중단된 위치를 기준으로 계산된다 (오차: 샘플 양자화 수준)
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::IMMEDIATE);
+  mover.moveTo(0.0);
+  EXPECT_NEAR(0.0, simMotor.getCurrentRotation(), 0.1);
+}
+
+// Phase 19: 최단 시간 프로파일
+TEST(RollWireMoverTest, SetMotorLimitsRejectsNonPositiveValues) {
+  // 모터 한계가 0 이하이면 INVALID_MOTOR_LIMITS를 반환한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTOR_LIMITS,
+            mover.setMotorLimits(0.0, 720.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTOR_LIMITS,
+            mover.setMotorLimits(150.0, -1.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+            mover.setMotorLimits(200.0, 900.0));
+  EXPECT_DOUBLE_EQ(200.0, mover.getMaxMotorRpm());
+  EXPECT_DOUBLE_EQ(900.0, mover.getMaxAngularAcceleration());
+}
+
+TEST(RollWireMoverTest, MinimumTimeMoveReachesTargetWithinMotorLimits) {
+  // 최단 시간 이동은 목표 회전량에 도달하며 모터 RPM 한계를 넘지 않는다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setVelocityProfile(RollWireMover::ProfileType::MINIMUM_TIME);
+  mover.setMotorLimits(150.0, 720.0);
+
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(4.0));
+
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(4.0), simMotor.getCurrentRotation(),
+              1e-6);
+
+  const std::vector<double> &rotations = simMotor.getLastProfile();
+  double maxDegPerSecond = 150.0 / 60.0 * 360.0;
+  for (size_t i = 1; i < rotations.size(); ++i) {
+    double rate = (rotations[i] - rotations[i - 1]) / 0.001;
+    ASSERT_LE(rate, maxDegPerSecond * (1.0 + 1e-6)) << "at sample " << i;
+  }
+}
+
+TEST(RollWireMoverTest, MinimumTimeWireSpeedFollowsRollRadius) {
+  // RPM 한계가 지배하면 롤 반지름이 클수록(감긴 쪽) 와이어 속도가 빠르다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setVelocityProfile(RollWireMover::ProfileType::MINIMUM_TIME);
+  mover.setMotorLimits(100.0, 3600.0);
+
+  mover.moveTo(5.0);
+  const std::vector<double> &profile = mover.getLastVelocityProfile();
+
+  // 이동 초반(반지름 큼)의 최고 속도 > 후반(반지름 작음)의 최고 속도
+  size_t half = profile.size() / 2;
+  double early = *std::max_element(profile.begin(), profile.begin() + half);
+  double late = *std::max_element(profile.begin() + half, profile.end());
+  EXPECT_GT(early, late * 1.1);
+}
+
+TEST(RollWireMoverTest, MinimumTimeMoveIsFasterThanFeasibleTrapezoid) {
+  // 전 구간에서 RPM 한계를 지키는 고정 사다리꼴보다 이동 시간이 짧다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setMotorLimits(150.0, 720.0);
+
+  // 최소 반지름(50mm)에서의 RPM / 각가속도 한계로 사다리꼴 설정
+  const double PI = 3.14159265358979323846;
+  double feasibleVelocity = 150.0 / 60.0 * 2.0 * PI * 0.05;
+  double feasibleAcceleration = 720.0 * PI / 180.0 * 0.05;
+  mover.setConstantVelocity(feasibleVelocity);
+  mover.setAccelerationTime(feasibleVelocity / feasibleAcceleration);
+  mover.setDecelerationTime(feasibleVelocity / feasibleAcceleration);
+  mover.moveTo(4.0);
+  size_t trapezoidSamples = mover.getLastVelocityProfile().size();
+
+  mover.moveTo(0.0);
+  mover.setVelocityProfile(RollWireMover::ProfileType::MINIMUM_TIME);
+  mover.moveTo(4.0);
+  size_t minimumTimeSamples = mover.getLastVelocityProfile().size();
+
+  EXPECT_LT(minimumTimeSamples, trapezoidSamples);
+}
+
+TEST(RollWireMoverTest, MinimumTimeSubMillimetreMoveCompletes) {
+  // 격자 간격(1mm) 이하의 짧은 이동도 유한한 프로파일로 목표에 도달한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setVelocityProfile(RollWireMover::ProfileType::MINIMUM_TIME);
+
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(0.0005));
+
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(0.0005), simMotor.getCurrentRotation(),
+              1e-6);
+  const std::vector<double> &profile = mover.getLastVelocityProfile();
+  EXPECT_GT(profile.size(), 2u);
+  EXPECT_LT(profile.size(), 1000u);
+  for (double velocity : profile) {
+    ASSERT_TRUE(std::isfinite(velocity));
+  }
+}
+
+// Phase 20: 회전 공간 계획 (정속 RPM)
+TEST(RollWireMoverTest, PlanningSpaceDefaultsToWire) {
+  // 기본 계획 공간은 WIRE이며 ROTATION으로 변경할 수 있다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::PlanningSpace::WIRE, mover.getPlanningSpace());
+  mover.setPlanningSpace(RollWireMover::PlanningSpace::ROTATION);
+  EXPECT_EQ(RollWireMover::PlanningSpace::ROTATION, mover.getPlanningSpace());
+}
+
+TEST(RollWireMoverTest, SetConstantRpmValidatesAgainstMotorLimit) {
+  // 정속 RPM은 0보다 크고 모터 최대 RPM 이하여야 한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setMotorLimits(100.0, 720.0);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_VELOCITY,
+            mover.setConstantRpm(0.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_VELOCITY,
+            mover.setConstantRpm(120.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setConstantRpm(60.0));
+  EXPECT_DOUBLE_EQ(60.0, mover.getConstantRpm());
+}
+
+TEST(RollWireMoverTest, MotorLimitBelowConstantRpmIsAcceptedInWireSpace) {
+  // 정속 RPM(기본 30)을 쓰지 않는 WIRE 공간에서는 모터 한계를 그 아래로
+  // 낮출 수 있다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setVelocityProfile(RollWireMover::ProfileType::MINIMUM_TIME);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+            mover.setMotorLimits(20.0, 720.0));
+  EXPECT_DOUBLE_EQ(20.0, mover.getMaxMotorRpm());
+  EXPECT_DOUBLE_EQ(30.0, mover.getConstantRpm());
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(0.5));
+
+  // 정속 RPM 자체를 한계 위로 올리는 것은 거부
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_VELOCITY,
+            mover.setConstantRpm(25.0));
+}
+
+TEST(RollWireMoverTest, RotationSpaceMoveIsCappedAtMotorLimit) {
+  // ROTATION 공간에서 모터 한계가 정속 RPM보다 낮으면 한계 RPM으로 움직인다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setPlanningSpace(RollWireMover::PlanningSpace::ROTATION);
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setConstantRpm(60.0));
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS,
+            mover.setMotorLimits(20.0, 720.0));
+
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(2.0));
+
+  // 정속 구간: 1ms당 20RPM × 6 × 0.001 = 0.12도
+  const std::vector<double> &rotations = simMotor.getLastProfile();
+  size_t middle = rotations.size() / 2;
+  EXPECT_NEAR(0.12, rotations[middle] - rotations[middle - 1], 1e-3);
+  EXPECT_DOUBLE_EQ(60.0, mover.getConstantRpm());
+}
+
+TEST(RollWireMoverTest, RotationSpaceMoveHasConstantRpmAndVaryingWireSpeed) {
+  // 정속 구간에서 회전 속도는 일정하고 와이어 속도는 반지름에 따라 줄어든다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setPlanningSpace(RollWireMover::PlanningSpace::ROTATION);
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  mover.setConstantRpm(60.0);
+
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(4.0));
+
+  // 목표 위치의 회전량에 정확히 도달
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(4.0), simMotor.getCurrentRotation(),
+              1e-6);
+
+  // 정속 구간 (가감속 0.1초 이후): 1ms당 60RPM × 6 × 0.001 = 0.36도
+  const std::vector<double> &rotations = simMotor.getLastProfile();
+  size_t middle = rotations.size() / 2;
+  EXPECT_NEAR(0.36, rotations[middle] - rotations[middle - 1], 1e-3);
+  EXPECT_NEAR(0.36, rotations[200] - rotations[199], 1e-3);
+
+  // 풀수록 반지름이 작아지므로 와이어 속도 감소
+  const std::vector<double> &wireSpeed = mover.getLastVelocityProfile();
+  EXPECT_GT(wireSpeed[200], wireSpeed[rotations.size() - 200]);
+}
+
+TEST(RollWireMoverTest, RotationSpaceRoundTripReturnsToStart) {
+  // 회전 공간 이동 후 되감으면 원래 회전량으로 돌아온다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setPlanningSpace(RollWireMover::PlanningSpace::ROTATION);
+  mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+
+  mover.moveTo(2.5);
+  mover.moveTo(0.0);
+
+  EXPECT_NEAR(0.0, simMotor.getCurrentRotation(), 1e-6);
+}
+
+// Phase 21: 이동 큐
+TEST(RollWireMoverTest, QueueMoveValidatesTargetAndVelocity) {
+  // 범위를 벗어난 목표, 속도, 음수 대기 시간은 큐에 넣지 않는다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::OUT_OF_RANGE, mover.queueMove(5.1));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_VELOCITY,
+            mover.queueMove(1.0, 2.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_DWELL_TIME,
+            mover.queueDwell(-0.1));
+  EXPECT_EQ(0u, mover.getQueuedCount());
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.queueMove(1.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.queueDwell(0.5));
+  EXPECT_EQ(2u, mover.getQueuedCount());
+  mover.clearQueue();
+  EXPECT_EQ(0u, mover.getQueuedCount());
+}
+
+TEST(RollWireMoverTest, SameDirectionMovesBlendThroughWaypoint) {
+  // 같은 방향 이동은 경유점에서 멈추지 않고 개별 이동보다 빨리 끝난다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(0.5);
+
+  // 개별 이동 시간 합
+  mover.moveTo(0.5);
+  size_t separate = mover.getLastVelocityProfile().size();
+  mover.moveTo(1.0);
+  separate += mover.getLastVelocityProfile().size();
+  mover.moveTo(0.0);
+
+  mover.queueMove(0.5);
+  mover.queueMove(1.0);
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executeQueue());
+
+  const std::vector<double> &profile = mover.getLastVelocityProfile();
+  EXPECT_LT(profile.size(), separate);
+  EXPECT_EQ(0u, mover.getQueuedCount());
+
+  // 경유점(0.5m) 통과 시 정속 유지
+  double travelled = 0.0;
+  for (double v : profile) {
+    travelled += v * mover.getControlPeriod();
+    if (travelled > 0.5) {
+      EXPECT_NEAR(0.5, v, 1e-6);
+      break;
+    }
+  }
+
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(1.0, mover.getCurrentPosition(), 1e-12);
+  EXPECT_NEAR(spool.rotationAtPosition(1.0), simMotor.getCurrentRotation(),
+              1e-6);
+}
+
+TEST(RollWireMoverTest, QueuedSubMillimetreMoveCompletes) {
+  // 격자 간격(1mm) 이하의 큐 이동도 유한한 프로파일로 목표에 도달한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.queueMove(0.0005));
+  ASSERT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executeQueue());
+
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(0.0005, mover.getCurrentPosition(), 1e-12);
+  EXPECT_NEAR(spool.rotationAtPosition(0.0005), simMotor.getCurrentRotation(),
+              1e-6);
+  const std::vector<double> &profile = mover.getLastVelocityProfile();
+  EXPECT_GT(profile.size(), 2u);
+  EXPECT_LT(profile.size(), 1000u);
+}
+
+TEST(RollWireMoverTest, QueueStopsAtReversalsAndHoldsDuringDwell) {
+  // 방향 전환 지점에서는 정지하고, 대기 중에는 회전량을 유지한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(0.5);
+
+  mover.queueMove(1.2);
+  mover.queueDwell(0.25);
+  mover.queueMove(0.8);
+  mover.queueMove(3.0);
+  mover.executeQueue();
+
+  // 0.8m 지점에서 방향이 바뀌므로 속도가 0이 되는 샘플이 있어야 함
+  const std::vector<double> &profile = mover.getLastVelocityProfile();
+  const std::vector<double> &rotations = simMotor.getLastProfile();
+  ASSERT_EQ(profile.size(), rotations.size());
+
+  size_t zeroRuns = 0;
+  for (size_t i = 1; i + 1 < profile.size(); ++i) {
+    if (profile[i] == 0.0 && profile[i - 1] != 0.0) {
+      zeroRuns++;
+    }
+  }
+  EXPECT_GE(zeroRuns, 2u); // 1.2m 도착(대기 포함), 0.8m 반전
+
+  // 대기 구간 250샘플 동안 회전량 일정
+  size_t firstStop = 1;
+  while (profile[firstStop] != 0.0) {
+    firstStop++;
+  }
+  for (size_t i = firstStop; i < firstStop + 250; ++i) {
+    EXPECT_DOUBLE_EQ(rotations[firstStop], rotations[i]);
+  }
+
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(3.0), simMotor.getCurrentRotation(),
+              1e-6);
+}
+
+TEST(RollWireMoverTest, BlendedRunRespectsSlowerSegmentVelocity) {
+  // 구간별 속도가 다르면 각 구간의 정속 속도를 넘지 않는다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(0.5);
+
+  mover.queueMove(1.0, 0.5);
+  mover.queueMove(2.0, 0.2);
+  mover.executeQueue();
+
+  double travelled = 0.0;
+  for (double v : mover.getLastVelocityProfile()) {
+    travelled += v * mover.getControlPeriod();
+    if (travelled > 1.0 + 0.002) {
+      ASSERT_LE(v, 0.2 + 1e-6);
+    }
+  }
+}
+
+// Phase 22: 비동기 계획 (이중 버퍼)
+TEST(RollWireMoverTest, ExecutePlannedMoveWithoutPlanReturnsError) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_FALSE(mover.hasPlannedMove());
+  EXPECT_EQ(RollWireMover::ErrorCode::NO_PLANNED_MOVE,
+            mover.executePlannedMove());
+  EXPECT_EQ(RollWireMover::ErrorCode::OUT_OF_RANGE, mover.planMove(6.0).get());
+  EXPECT_FALSE(mover.hasPlannedMove());
+}
+
+TEST(RollWireMoverTest, PlannedMoveMatchesSynchronousMove) {
+  // 백그라운드 계획 결과는 moveTo와 같은 회전량 배열이다
+  SimMotor syncMotor;
+  SimMotor asyncMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover syncMover(1.0, 50.0, &syncMotor, error);
+  RollWireMover asyncMover(1.0, 50.0, &asyncMotor, error);
+
+  syncMover.moveTo(2.0);
+  syncMover.moveTo(0.5);
+
+  asyncMover.planMove(2.0);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, asyncMover.executePlannedMove());
+  std::shared_future<RollWireMover::ErrorCode> done = asyncMover.planMove(0.5);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, done.get());
+  EXPECT_TRUE(asyncMover.hasPlannedMove());
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, asyncMover.executePlannedMove());
+
+  EXPECT_DOUBLE_EQ(0.5, asyncMover.getCurrentPosition());
+  EXPECT_EQ(syncMotor.getLastProfile(), asyncMotor.getLastProfile());
+  EXPECT_EQ(syncMover.getLastVelocityProfile(),
+            asyncMover.getLastVelocityProfile());
+}
+
+TEST(RollWireMoverTest, NextMoveIsPlannedWhileCurrentMoveExecutes) {
+  // 실행 중 계획한 다음 이동은 현재 이동의 끝 회전량에서 이어진다
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setTrajectoryMode(RollWireMover::TrajectoryMode::PARAMETRIC);
+  mover.setConstantVelocity(0.5);
+
+  mover.moveTo(1.0);
+  double endRotation = simMotor.getLastTrajectory().finalRotation();
+  mover.planMove(2.0).wait();
+
+  // 현재 이동이 끝나기 전에는 실행하지 않음
+  EXPECT_EQ(RollWireMover::ErrorCode::MOTOR_BUSY, mover.executePlannedMove());
+  EXPECT_TRUE(mover.hasPlannedMove());
+
+  simMotor.setTimeWarp(true);
+  simMotor.runUntil(simMotor.getLastTrajectory().duration());
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executePlannedMove());
+  EXPECT_DOUBLE_EQ(endRotation, simMotor.getLastTrajectory().startRotation);
+
+  while (simMotor.isRunning()) {
+    simMotor.stepN(1000);
+  }
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(2.0), simMotor.getCurrentRotation(),
+              0.1); // 반올림 양자화 오차
+
+  RollWireMover::PlanningStats stats = mover.getPlanningStats();
+  EXPECT_EQ(1u, stats.plansRequested);
+  EXPECT_EQ(1u, stats.plansExecuted);
+  EXPECT_EQ(1u, stats.readyBeforeNeeded);
+  EXPECT_DOUBLE_EQ(1.0, stats.readyRate());
+  EXPECT_GT(stats.totalPlanTime, 0.0);
+}
+
+TEST(RollWireMoverTest, StalePlanIsReplannedFromCurrentState) {
+  // 계획 이후 다른 이동 명령이 있으면 현재 위치 기준으로 다시 계획한다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  mover.planMove(2.0).wait();
+  mover.moveTo(1.0);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executePlannedMove());
+
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  EXPECT_DOUBLE_EQ(2.0, mover.getCurrentPosition());
+  EXPECT_NEAR(spool.rotationAtPosition(2.0), simMotor.getCurrentRotation(),
+              0.1);
+  EXPECT_EQ(1u, mover.getPlanningStats().stalePlans);
+
+  mover.resetPlanningStats();
+  EXPECT_EQ(0u, mover.getPlanningStats().plansRequested);
+}
+
+// Phase 24: 스레드 안전 (파라미터 블록 교체, 상태 SeqLock)
+TEST(RollWireMoverTest, StatusSnapshotTracksMoves) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  RollWireMover::Status status = mover.getStatus();
+  EXPECT_DOUBLE_EQ(0.0, status.position);
+  EXPECT_EQ(RollWireMover::MotionState::STOPPED, status.state);
+  EXPECT_EQ(0u, status.moveCount);
+
+  mover.moveTo(1.5);
+  mover.moveTo(1.5); // 이동 없음
+  status = mover.getStatus();
+  EXPECT_DOUBLE_EQ(1.5, status.position);
+  EXPECT_EQ(1u, status.moveCount);
+}
+
+TEST(RollWireMoverTest, ConcurrentReadersSeeConsistentStateDuringCommands) {
+  // 명령 스레드가 이동/설정을 바꾸는 동안 조회 스레드는 일관된 값만 본다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.setConstantVelocity(1.0);
+
+  std::atomic<bool> done(false);
+  std::atomic<size_t> inconsistent(0);
+  std::atomic<size_t> reads(0);
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 2; r++) {
+    readers.emplace_back([&] {
+      while (!done.load()) {
+        // 홀수 번째 이동은 0.5m, 짝수 번째 이동은 1.0m로 이동
+        RollWireMover::Status status = mover.getStatus();
+        double expected = status.moveCount == 0 ? 0.0
+                          : status.moveCount % 2 == 1 ? 0.5
+                                                      : 1.0;
+        if (status.position != expected) {
+          inconsistent++;
+        }
+        double period = mover.getControlPeriod();
+        if (period != 0.001 && period != 0.002) {
+          inconsistent++;
+        }
+        reads++;
+      }
+    });
+  }
+
+  // 조회 스레드가 시작된 뒤 명령 실행
+  while (reads.load() == 0) {
+    std::this_thread::yield();
+  }
+  for (int i = 0; i < 200; i++) {
+    mover.setControlPeriod(i % 2 == 0 ? 0.002 : 0.001);
+    mover.moveTo(i % 2 == 0 ? 0.5 : 1.0);
+  }
+  done = true;
+  for (std::thread &reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(0u, inconsistent.load());
+  EXPECT_EQ(200u, mover.getStatus().moveCount);
+  EXPECT_DOUBLE_EQ(1.0, mover.getCurrentPosition());
+}
+
+TEST(RollWireMoverTest, ConcurrentCommandThreadsAreSerialized) {
+  // 두 명령 스레드가 번갈아 설정/이동해도 파라미터와 위치가 손실되지 않는다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  std::thread commandThread([&] {
+    for (int i = 0; i < 200; i++) {
+      mover.setMotorLimits(100.0 + i, 720.0);
+      mover.moveRelative(0.001);
+    }
+  });
+  for (int i = 0; i < 200; i++) {
+    mover.setQuantizationMode(RollWireMover::QuantizationMode::EXACT_DISTANCE);
+    mover.moveRelative(0.001);
+  }
+  commandThread.join();
+
+  EXPECT_NEAR(0.4, mover.getCurrentPosition(), 1e-9);
+  EXPECT_EQ(400u, mover.getStatus().moveCount);
+  EXPECT_DOUBLE_EQ(299.0, mover.getMaxMotorRpm());
+  EXPECT_EQ(RollWireMover::QuantizationMode::EXACT_DISTANCE,
+            mover.getQuantizationMode());
+}
+
+// Phase 25: 불변 모션 설정 (MotionConfig)
+TEST(RollWireMoverTest, MotionConfigValidatesOnceAtCreate) {
+  // create()는 개별 set* 메서드와 같은 에러 코드로 검증한다
+  RollWireMover::ErrorCode error;
+  RollWireMover::MotionSettings settings;
+
+  auto config = RollWireMover::MotionConfig::create(settings, 1.0, 50.0, error);
+  ASSERT_NE(nullptr, config);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, error);
+  // 기본 설정: 0.1초 램프 / 1ms 주기 → 100 샘플, 가속 거리 0.5·v·t
+  EXPECT_EQ(100, config->accelerationSteps);
+  EXPECT_EQ(100, config->exactDecelerationSteps);
+  EXPECT_DOUBLE_EQ(0.005, config->accelerationDistance);
+  EXPECT_NEAR(2.0 * 3.14159265358979323846 * 150.0 / 60.0,
+              config->maxAngularVelocityRad, 1e-12);
+
+  settings.accelerationTime = 0.0;
+  EXPECT_EQ(nullptr,
+            RollWireMover::MotionConfig::create(settings, 1.0, 50.0, error));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_ACCELERATION_TIME, error);
+
+  settings = RollWireMover::MotionSettings();
+  settings.controlPeriod = 1.0;
+  RollWireMover::MotionConfig::create(settings, 1.0, 50.0, error);
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_CONTROL_PERIOD, error);
+
+  RollWireMover::MotionConfig::create(RollWireMover::MotionSettings(), 0.0,
+                                      50.0, error);
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_WIRE_THICKNESS, error);
+}
+
+TEST(RollWireMoverTest, SetMotionConfigPublishesAllParametersAtOnce) {
+  // 여러 파라미터를 하나의 블록으로 교체하고, 기존 블록은 그대로 유지된다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  auto before = mover.getMotionConfig();
+
+  RollWireMover::MotionSettings settings = before->getSettings();
+  settings.controlPeriod = 0.002;
+  settings.maxMotorRpm = 120.0;
+  settings.quantizationMode = RollWireMover::QuantizationMode::EXACT_DISTANCE;
+  auto config = mover.makeMotionConfig(settings, error);
+  ASSERT_NE(nullptr, config);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setMotionConfig(config));
+  EXPECT_EQ(config, mover.getMotionConfig());
+  EXPECT_DOUBLE_EQ(0.002, mover.getControlPeriod());
+  EXPECT_DOUBLE_EQ(0.002, simMotor.getControlPeriod());
+  EXPECT_DOUBLE_EQ(120.0, mover.getMaxMotorRpm());
+  EXPECT_EQ(RollWireMover::QuantizationMode::EXACT_DISTANCE,
+            mover.getQuantizationMode());
+  EXPECT_DOUBLE_EQ(0.001, before->controlPeriod);
+
+  // 검증 실패한 setter는 게시된 블록을 바꾸지 않는다
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_VELOCITY,
+            mover.setConstantVelocity(5.0));
+  EXPECT_EQ(config, mover.getMotionConfig());
+}
+
+TEST(RollWireMoverTest, MoveWithPrecomputedConfigMatchesSetterMove) {
+  // 미리 만든 설정으로 이동한 결과가 setter로 설정한 이동과 같다
+  SimMotor first;
+  SimMotor second;
+  RollWireMover::ErrorCode error;
+  RollWireMover configured(1.0, 50.0, &first, error);
+  RollWireMover precomputed(1.0, 50.0, &second, error);
+
+  configured.setConstantVelocity(0.5);
+  configured.setQuantizationMode(
+      RollWireMover::QuantizationMode::EXACT_DISTANCE);
+  RollWireMover::MotionSettings settings;
+  settings.constantVelocity = 0.5;
+  settings.quantizationMode = RollWireMover::QuantizationMode::EXACT_DISTANCE;
+  auto config = precomputed.makeMotionConfig(settings, error);
+  ASSERT_NE(nullptr, config);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, configured.moveTo(1.3));
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+            precomputed.moveTo(1.3, *config));
+  EXPECT_EQ(configured.getLastVelocityProfile(),
+            precomputed.getLastVelocityProfile());
+  EXPECT_DOUBLE_EQ(first.getCurrentRotation(), second.getCurrentRotation());
+  EXPECT_DOUBLE_EQ(1.3, precomputed.getCurrentPosition());
+}
+
+TEST(RollWireMoverTest, MismatchedMotionConfigIsRejected) {
+  // 다른 형상이나 제어 주기의 설정은 이동/게시에 쓸 수 없다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  auto otherSpool = RollWireMover::MotionConfig::create(
+      RollWireMover::MotionSettings(), 2.0, 50.0, error);
+  RollWireMover::MotionSettings settings;
+  settings.controlPeriod = 0.002;
+  auto otherPeriod = mover.makeMotionConfig(settings, error);
+  RollWireMover::MotionSettings longer;
+  longer.maxWireLength = 8.0; // 스풀 변환의 전체 길이가 다름
+  auto otherLength = mover.makeMotionConfig(longer, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTION_CONFIG,
+            mover.moveTo(1.0, *otherSpool));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTION_CONFIG,
+            mover.moveTo(1.0, *otherPeriod));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTION_CONFIG,
+            mover.moveTo(1.0, *otherLength));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTION_CONFIG,
+            mover.setMotionConfig(otherLength));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTION_CONFIG,
+            mover.setMotionConfig(otherSpool));
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTION_CONFIG,
+            mover.setMotionConfig(nullptr));
+  EXPECT_DOUBLE_EQ(0.0, mover.getCurrentPosition());
+}
+
+// Phase 26: 스풀 교체 (롤 내경 변경)
+TEST(RollWireMoverTest, SetInnerRadiusRebuildsSpoolLazily) {
+  // 내경 변경은 램프 상수를 재사용하고 스풀 변환만 다음 이동 때 다시 만든다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  auto before = mover.getMotionConfig();
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setInnerRadius(80.0));
+  auto after = mover.getMotionConfig();
+  EXPECT_DOUBLE_EQ(80.0, mover.getInnerRadius());
+  EXPECT_DOUBLE_EQ(50.0, before->innerRadius);
+  EXPECT_EQ(before->accelerationSteps, after->accelerationSteps);
+  EXPECT_DOUBLE_EQ(before->maxAngularVelocityRad,
+                   after->maxAngularVelocityRad);
+  EXPECT_TRUE(before->hasSpool());
+  EXPECT_FALSE(after->hasSpool());
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.moveTo(1.0));
+  EXPECT_TRUE(after->hasSpool());
+}
+
+TEST(RollWireMoverTest, MoveAfterSpoolSwapUsesNewRadius) {
+  // 교체 후 이동은 새 롤로 새로 만든 이동기와 같은 회전량을 명령한다
+  SimMotor swapped;
+  SimMotor fresh;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &swapped, error);
+  RollWireMover reference(1.0, 80.0, &fresh, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setInnerRadius(80.0));
+  mover.moveTo(1.0);
+  reference.moveTo(1.0);
+  EXPECT_NEAR(fresh.getCurrentRotation(), swapped.getCurrentRotation(), 1e-9);
+
+  SpoolGeometry spool(1.0, 80.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(1.0), swapped.getCurrentRotation(),
+              0.1);
+}
+
+TEST(RollWireMoverTest, SpoolSwapInvalidatesPlansAndConfigs) {
+  // 교체 전에 만든 계획은 다시 계획되고, 이전 설정으로는 이동할 수 없다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  auto oldConfig = mover.getMotionConfig();
+
+  mover.planMove(1.0).wait();
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setInnerRadius(80.0));
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executePlannedMove());
+  EXPECT_EQ(1u, mover.getPlanningStats().stalePlans);
+
+  SpoolGeometry spool(1.0, 80.0, 5.0);
+  EXPECT_NEAR(spool.rotationAtPosition(1.0), simMotor.getCurrentRotation(),
+              0.1);
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_MOTION_CONFIG,
+            mover.moveTo(0.5, *oldConfig));
+}
+
+TEST(RollWireMoverTest, SetInnerRadiusIsRejectedWhileMoving) {
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  mover.moveTo(0.5);
+  EXPECT_EQ(RollWireMover::ErrorCode::MOTOR_BUSY, mover.setInnerRadius(80.0));
+  EXPECT_DOUBLE_EQ(50.0, mover.getInnerRadius());
+}
+
+TEST(RollWireMoverTest, SetMaxWireLengthIsRejectedWhileMoving) {
+  // 최대 길이도 스풀 모델의 일부이므로 이동 중에는 바꾸지 않는다
+  SimMotor simMotor;
+  simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  std::shared_ptr<const RollWireMover::MotionConfig> before =
+      mover.getMotionConfig();
+
+  mover.moveTo(0.5);
+  EXPECT_EQ(RollWireMover::ErrorCode::MOTOR_BUSY, mover.setMaxWireLength(8.0));
+  EXPECT_EQ(before, mover.getMotionConfig());
+
+  while (simMotor.stepN(1000) > 0) {
+  }
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.setMaxWireLength(8.0));
+  EXPECT_DOUBLE_EQ(8.0, mover.getMotionConfig()->maxWireLength);
+}
+
+// Phase 31: 할당 집계 (훅 미연결)
+TEST(RollWireMoverTest, AllocationStatsAreEmptyWithoutHook) {
+  // 할당 훅을 링크하지 않은 실행 파일에서는 집계하지 않는다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  mover.moveTo(1.0);
+  RollWireMover::AllocationStats stats = mover.getAllocationStats();
+  EXPECT_FALSE(stats.tracking);
+  EXPECT_EQ(0u, stats.moves);
+  EXPECT_EQ(0u, stats.lastBytes);
+}
+
+// Phase 32: 속도 프로파일 기록 모드
+TEST(RollWireMoverTest, ProfileCaptureDefaultsToLast) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::ProfileCaptureMode::LAST,
+            mover.getProfileCaptureMode());
+  mover.moveTo(0.5);
+  EXPECT_FALSE(mover.getLastVelocityProfile().empty());
+  EXPECT_TRUE(mover.getProfileHistory().empty());
+}
+
+TEST(RollWireMoverTest, ProfileCaptureOffKeepsNothing) {
+  // OFF 모드에서는 이동 후 프로파일을 보관하지 않지만 이동은 같다
+  SimMotor capturedMotor;
+  SimMotor plainMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover captured(1.0, 50.0, &capturedMotor, error);
+  RollWireMover plain(1.0, 50.0, &plainMotor, error);
+  captured.moveTo(0.3);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+            plain.setProfileCapture(RollWireMover::ProfileCaptureMode::OFF));
+
+  captured.moveTo(1.2);
+  plain.moveTo(0.3);
+  plain.moveTo(1.2);
+
+  EXPECT_TRUE(plain.getLastVelocityProfile().empty());
+  EXPECT_DOUBLE_EQ(capturedMotor.getCurrentRotation(),
+                   plainMotor.getCurrentRotation());
+}
+
+TEST(RollWireMoverTest, ProfileHistoryKeepsLastNMovesInOrder) {
+  // HISTORY 모드는 최근 N개 이동을 오래된 순으로 돌려준다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+            mover.setProfileCapture(RollWireMover::ProfileCaptureMode::HISTORY,
+                                    3));
+
+  std::vector<size_t> sizes;
+  for (double target : {0.1, 0.3, 0.6, 1.0, 1.5}) {
+    mover.moveTo(target);
+    sizes.push_back(mover.getLastVelocityProfile().size());
+  }
+
+  std::vector<RollWireMover::CapturedProfile> history =
+      mover.getProfileHistory();
+  ASSERT_EQ(3u, history.size());
+  for (size_t i = 0; i < history.size(); i++) {
+    EXPECT_EQ(3u + i, history[i].sequence);
+    EXPECT_EQ(1u, history[i].decimation);
+    EXPECT_EQ(sizes[2 + i], history[i].velocity.size());
+  }
+  EXPECT_EQ(mover.getLastVelocityProfile(), history.back().velocity);
+}
+
+TEST(RollWireMoverTest, ProfileHistoryDecimatesLongProfiles) {
+  // maxSamples를 넘는 프로파일은 일정 간격으로 솎아 기록한다
+  SimMotor fullMotor;
+  SimMotor decimatedMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover full(1.0, 50.0, &fullMotor, error);
+  RollWireMover decimated(1.0, 50.0, &decimatedMotor, error);
+  decimated.setProfileCapture(RollWireMover::ProfileCaptureMode::HISTORY, 2,
+                              100);
+
+  full.moveTo(2.0);
+  decimated.moveTo(2.0);
+
+  const std::vector<double> &profile = full.getLastVelocityProfile();
+  RollWireMover::CapturedProfile captured = decimated.getProfileHistory()[0];
+  ASSERT_GT(profile.size(), 100u);
+  EXPECT_LE(captured.velocity.size(), 100u);
+  EXPECT_GT(captured.decimation, 1u);
+  for (size_t i = 0; i < captured.velocity.size(); i++) {
+    EXPECT_DOUBLE_EQ(profile[i * captured.decimation], captured.velocity[i]);
+  }
+}
+
+TEST(RollWireMoverTest, EmptyQueueLeavesCapturedProfileUnchanged) {
+  // 전달할 이동이 없는 executeQueue()는 기록을 덮어쓰지 않는다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.moveTo(0.5);
+  std::vector<double> last = mover.getLastVelocityProfile();
+  ASSERT_FALSE(last.empty());
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executeQueue());
+  EXPECT_EQ(last, mover.getLastVelocityProfile());
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS,
+            mover.setProfileCapture(RollWireMover::ProfileCaptureMode::HISTORY,
+                                    4));
+  mover.moveTo(0.8);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover.executeQueue());
+  ASSERT_EQ(1u, mover.getProfileHistory().size());
+  EXPECT_EQ(2u, mover.getProfileHistory()[0].sequence);
+}
+
+TEST(RollWireMoverTest, ProfileHistoryRejectsZeroDepth) {
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_CAPTURE_CONFIG,
+            mover.setProfileCapture(RollWireMover::ProfileCaptureMode::HISTORY,
+                                    0));
+  EXPECT_EQ(RollWireMover::ProfileCaptureMode::LAST,
+            mover.getProfileCaptureMode());
+}
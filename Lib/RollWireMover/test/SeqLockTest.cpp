@@ -0,0 +1,106 @@
+#include "SeqLock.h"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// 모든 필드가 같은 값이어야 하는 레코드 (찢어진 읽기 검출용)
+struct Record {
+  uint64_t a;
+  uint64_t b;
+  double c;
+  uint32_t d;
+};
+
+} // namespace
+
+// Phase 24.1: SeqLock
+TEST(SeqLockTest, LoadReturnsLastStoredValue) {
+  SeqLock<Record> lock(Record{1, 1, 1.0, 1});
+  EXPECT_EQ(1u, lock.version());
+
+  lock.store(Record{7, 8, 9.5, 10});
+  Record value = lock.load();
+  EXPECT_EQ(7u, value.a);
+  EXPECT_EQ(8u, value.b);
+  EXPECT_DOUBLE_EQ(9.5, value.c);
+  EXPECT_EQ(10u, value.d);
+  EXPECT_EQ(2u, lock.version());
+}
+
+TEST(SeqLockTest, TryLoadReportsVersionOfValueRead) {
+  // tryLoad는 재시도 없이 한 번 읽고, 읽은 값까지의 기록 횟수를 돌려준다
+  SeqLock<Record> lock;
+  lock.store(Record{3, 3, 3.0, 3});
+  lock.store(Record{4, 4, 4.0, 4});
+
+  Record value{};
+  uint64_t version = 0;
+  ASSERT_TRUE(lock.tryLoad(value, version));
+  EXPECT_EQ(4u, value.a);
+  EXPECT_EQ(2u, version);
+  EXPECT_EQ(lock.version(), version);
+}
+
+TEST(SeqLockTest, ConcurrentReadersNeverSeeTornValues) {
+  // 기록 중에도 독자는 항상 한 번의 store()로 기록된 값 전체를 읽는다
+  // 독자가 모두 시작한 뒤 기록을 시작하고, 독자마다 MIN_READS번 이상 읽을
+  // 때까지 계속 기록한다 (코어가 하나여도 기록과 읽기가 겹치도록 양보)
+  const int READERS = 3;
+  const size_t MIN_READS = 1000;
+  const uint64_t MIN_STORES = 10000;
+  SeqLock<Record> lock(Record{0, 0, 0.0, 0});
+  std::atomic<bool> done(false);
+  std::atomic<int> ready(0);
+  std::atomic<size_t> torn(0);
+  std::vector<std::atomic<size_t>> reads(READERS);
+  for (std::atomic<size_t> &count : reads) {
+    count.store(0);
+  }
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < READERS; r++) {
+    readers.emplace_back([&, r] {
+      ready++;
+      while (!done.load()) {
+        Record value = lock.load();
+        if (value.b != value.a || value.c != static_cast<double>(value.a) ||
+            value.d != static_cast<uint32_t>(value.a)) {
+          torn++;
+        }
+        reads[r]++;
+      }
+    });
+  }
+  while (ready.load() < READERS) {
+    std::this_thread::yield();
+  }
+
+  auto fewestReads = [&reads] {
+    size_t fewest = reads[0].load();
+    for (const std::atomic<size_t> &count : reads) {
+      fewest = std::min(fewest, count.load());
+    }
+    return fewest;
+  };
+  uint64_t stores = 0;
+  while (stores < MIN_STORES || fewestReads() < MIN_READS) {
+    stores++;
+    lock.store(Record{stores, stores, static_cast<double>(stores),
+                      static_cast<uint32_t>(stores)});
+    if (stores % 64 == 0) {
+      std::this_thread::yield();
+    }
+  }
+  done = true;
+  for (std::thread &reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(0u, torn.load());
+  EXPECT_GE(fewestReads(), MIN_READS);
+  EXPECT_EQ(stores, lock.load().a);
+}
@@ -0,0 +1,130 @@
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include "SimMotorBank.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+// Phase 17.1: SimMotorBank 기본 동작
+TEST(SimMotorBankTest, AddMotorReturnsSequentialIndices) {
+  // 추가한 모터는 정지 상태, 회전량 0에서 시작한다
+  SimMotorBank bank;
+
+  EXPECT_EQ(0u, bank.addMotor());
+  EXPECT_EQ(1u, bank.addMotor());
+  EXPECT_EQ(2u, bank.size());
+  EXPECT_FALSE(bank.isRunning(1));
+  EXPECT_DOUBLE_EQ(0.0, bank.getCurrentRotation(1));
+}
+
+TEST(SimMotorBankTest, ExecuteLoadsProfileWithoutRunningIt) {
+  // 핸들의 executeRotationProfile()은 적재만 하고 stepAll()에서 진행한다
+  SimMotorBank bank;
+  bank.addMotor();
+  Motor &motor = bank.motor(0);
+
+  motor.executeRotationProfile(std::vector<double>{1.0, 2.0, 3.0});
+
+  EXPECT_TRUE(motor.isRunning());
+  EXPECT_DOUBLE_EQ(0.0, motor.getCurrentRotation());
+
+  bank.stepAll();
+  EXPECT_DOUBLE_EQ(1.0, motor.getCurrentRotation());
+  bank.stepAll(2);
+  EXPECT_DOUBLE_EQ(3.0, motor.getCurrentRotation());
+  EXPECT_FALSE(motor.isRunning());
+}
+
+TEST(SimMotorBankTest, IdleMotorsHoldLastRotation) {
+  // 프로파일이 끝난 모터는 다른 모터가 진행되는 동안 마지막 값을 유지한다
+  SimMotorBank bank;
+  bank.addMotor();
+  bank.addMotor();
+  bank.motor(0).executeRotationProfile(std::vector<double>{5.0});
+  bank.motor(1).executeRotationProfile(std::vector<double>{1.0, 2.0, 3.0, 4.0});
+
+  EXPECT_EQ(2u, bank.getRunningCount());
+  EXPECT_EQ(4u, bank.runUntilIdle());
+
+  EXPECT_DOUBLE_EQ(5.0, bank.getCurrentRotation(0));
+  EXPECT_DOUBLE_EQ(4.0, bank.getCurrentRotation(1));
+  EXPECT_EQ(0u, bank.getRunningCount());
+  EXPECT_NEAR(0.004, bank.getElapsedTime(), 1e-12);
+}
+
+TEST(SimMotorBankTest, StopAndResetPositionAffectOnlyOneMotor) {
+  // stop()/resetPosition()은 해당 모터에만 적용된다
+  SimMotorBank bank;
+  bank.addMotor();
+  bank.addMotor();
+  bank.motor(0).executeRotationProfile(std::vector<double>{1.0, 2.0, 3.0});
+  bank.motor(1).executeRotationProfile(std::vector<double>{1.0, 2.0, 3.0});
+  bank.stepAll();
+
+  bank.motor(0).stop();
+  bank.motor(1).resetPosition();
+  bank.stepAll();
+
+  EXPECT_FALSE(bank.isRunning(0));
+  EXPECT_DOUBLE_EQ(1.0, bank.getCurrentRotation(0));
+  EXPECT_TRUE(bank.isRunning(1));
+  EXPECT_DOUBLE_EQ(2.0, bank.getCurrentRotation(1));
+}
+
+// Phase 17.2: 프로파일 버퍼 재사용
+TEST(SimMotorBankTest, RepeatedLoadsKeepPlaybackCorrect) {
+  // 버퍼 정리(compact)가 일어나도 재생 중인 프로파일은 그대로 이어진다
+  SimMotorBank bank;
+  bank.addMotor();
+  bank.addMotor();
+
+  std::vector<double> longProfile(200000);
+  for (size_t i = 0; i < longProfile.size(); ++i) {
+    longProfile[i] = i * 0.5;
+  }
+  bank.motor(0).executeRotationProfile(longProfile);
+  bank.stepAll(10);
+
+  // 다른 모터에 큰 프로파일을 반복 적재
+  for (int round = 0; round < 5; ++round) {
+    bank.motor(1).executeRotationProfile(longProfile);
+    bank.stepAll(10);
+  }
+
+  EXPECT_DOUBLE_EQ(longProfile[59], bank.getCurrentRotation(0));
+  EXPECT_DOUBLE_EQ(longProfile[9], bank.getCurrentRotation(1));
+  bank.runUntilIdle();
+  EXPECT_DOUBLE_EQ(longProfile.back(), bank.getCurrentRotation(0));
+  EXPECT_DOUBLE_EQ(longProfile.back(), bank.getCurrentRotation(1));
+}
+
+// Phase 17.3: RollWireMover 연동
+TEST(SimMotorBankTest, MoversDriveBankMotorsLikeSteppedSimMotors) {
+  // 뱅크 모터로 구동한 결과는 STEPPED 모드 SimMotor와 같다
+  SimMotorBank bank;
+  SimMotor reference;
+  reference.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+
+  RollWireMover::ErrorCode error;
+  std::vector<std::unique_ptr<RollWireMover>> movers;
+  for (size_t i = 0; i < 4; ++i) {
+    bank.addMotor();
+    movers.push_back(
+        std::make_unique<RollWireMover>(1.0, 50.0, &bank.motor(i), error));
+  }
+  RollWireMover referenceMover(1.0, 50.0, &reference, error);
+
+  for (auto &mover : movers) {
+    EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, mover->moveTo(2.5));
+  }
+  referenceMover.moveTo(2.5);
+
+  size_t samples = bank.runUntilIdle();
+  EXPECT_EQ(reference.getLastProfile().size(), samples);
+  reference.stepN(samples);
+
+  for (size_t i = 0; i < bank.size(); ++i) {
+    EXPECT_DOUBLE_EQ(reference.getCurrentRotation(),
+                     bank.getCurrentRotation(i));
+  }
+}
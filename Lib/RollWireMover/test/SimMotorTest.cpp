@@ -210,3 +210,280 @@ TEST(SimMotorTest, StopMaintainsCurrentPosition) {
     EXPECT_DOUBLE_EQ(270.0, simMotor.getCurrentRotation());
     EXPECT_DOUBLE_EQ(270.0, simMotor.getCurrentRotation());
 }
+
+// Phase 12: 제어 주기
+TEST(SimMotorTest, DefaultControlPeriodIs1ms) {
+    // 기본 제어 주기는 1ms이고 누적 시간은 0이다
+    SimMotor simMotor;
+
+    EXPECT_DOUBLE_EQ(0.001, simMotor.getControlPeriod());
+    EXPECT_DOUBLE_EQ(0.0, simMotor.getElapsedTime());
+}
+
+TEST(SimMotorTest, StepAdvancesElapsedTimeByControlPeriod) {
+    // step() 한 번마다 누적 시간이 제어 주기만큼 증가한다
+    SimMotor simMotor;
+    simMotor.setControlPeriod(0.004);
+
+    std::vector<double> profile = {1.0, 2.0, 3.0};
+    simMotor.loadProfile(profile);
+    simMotor.startExecution();
+    simMotor.step();
+    simMotor.step();
+
+    EXPECT_DOUBLE_EQ(0.004, simMotor.getControlPeriod());
+    EXPECT_NEAR(0.008, simMotor.getElapsedTime(), 1e-12);
+}
+
+TEST(SimMotorTest, ExecuteRotationProfileAdvancesElapsedTimeByProfileDuration) {
+    // executeRotationProfile()은 프로파일 길이 × 제어 주기만큼 시간을 진행한다
+    SimMotor simMotor;
+    simMotor.setControlPeriod(0.00025);
+
+    std::vector<double> profile(400, 10.0);
+    simMotor.executeRotationProfile(profile);
+
+    EXPECT_NEAR(0.1, simMotor.getElapsedTime(), 1e-12);
+}
+
+// Phase 13.4: SimMotor 매개변수 궤적 실행
+static MotionTrajectory makeSimMotorTrajectory() {
+    MotionTrajectory trajectory;
+    trajectory.accSteps = 20;
+    trajectory.constSteps = 30;
+    trajectory.decSteps = 20;
+    trajectory.peakVelocity = 0.2;
+    trajectory.accRampTime = 0.02;
+    trajectory.decRampTime = 0.02;
+    trajectory.startRotation = 5.0;
+    trajectory.innerRadius = 50.0;
+    return trajectory;
+}
+
+TEST(SimMotorTest, ExecuteTrajectoryMovesToFinalRotationWithoutSamples) {
+    // executeTrajectory()는 배열 없이 궤적의 최종 회전량으로 이동한다
+    SimMotor simMotor;
+    MotionTrajectory trajectory = makeSimMotorTrajectory();
+
+    simMotor.executeTrajectory(trajectory);
+
+    EXPECT_TRUE(simMotor.hasTrajectory());
+    EXPECT_TRUE(simMotor.getLastProfile().empty());
+    EXPECT_FALSE(simMotor.isRunning());
+    EXPECT_DOUBLE_EQ(trajectory.finalRotation(), simMotor.getCurrentRotation());
+    EXPECT_NEAR(trajectory.duration(), simMotor.getElapsedTime(), 1e-12);
+}
+
+TEST(SimMotorTest, StepEvaluatesLoadedTrajectoryOnTheFly) {
+    // loadTrajectory() 후 step()은 각 샘플의 회전량을 실행 시점에 평가한다
+    SimMotor simMotor;
+    MotionTrajectory trajectory = makeSimMotorTrajectory();
+
+    simMotor.loadTrajectory(trajectory);
+    simMotor.startExecution();
+
+    for (size_t k = 0; k < trajectory.sampleCount(); ++k) {
+        ASSERT_TRUE(simMotor.isRunning());
+        simMotor.step();
+        EXPECT_DOUBLE_EQ(trajectory.rotationAt(k), simMotor.getCurrentRotation());
+    }
+    EXPECT_FALSE(simMotor.isRunning());
+}
+
+TEST(SimMotorTest, LoadProfileReplacesLoadedTrajectory) {
+    // 배열 프로파일을 로드하면 이전 궤적 대신 배열을 실행한다
+    SimMotor simMotor;
+    simMotor.loadTrajectory(makeSimMotorTrajectory());
+
+    std::vector<double> profile = {1.0, 2.0};
+    simMotor.loadProfile(profile);
+    simMotor.startExecution();
+    simMotor.step();
+    simMotor.step();
+
+    EXPECT_FALSE(simMotor.hasTrajectory());
+    EXPECT_DOUBLE_EQ(2.0, simMotor.getCurrentRotation());
+    EXPECT_FALSE(simMotor.isRunning());
+}
+
+// Phase 14: 복사 없는 프로파일 전달
+TEST(SimMotorTest, ExecuteRotationProfileWithRvalueTakesBufferWithoutCopy) {
+    // rvalue로 전달한 배열은 버퍼 소유권만 이전된다 (같은 메모리 사용)
+    SimMotor simMotor;
+    std::vector<double> profile = {10.0, 20.0, 30.0};
+    const double *buffer = profile.data();
+
+    simMotor.executeRotationProfile(std::move(profile));
+
+    EXPECT_EQ(buffer, simMotor.getLastProfile().data());
+    EXPECT_DOUBLE_EQ(30.0, simMotor.getCurrentRotation());
+}
+
+TEST(SimMotorTest, ExecuteRotationProfileWithSharedPointerSharesBuffer) {
+    // shared_ptr로 전달한 배열은 호출 측 버퍼를 그대로 공유한다
+    SimMotor simMotor;
+    auto profile = std::make_shared<const std::vector<double>>(
+        std::vector<double>{1.0, 2.0, 3.0, 4.0});
+
+    simMotor.executeRotationProfile(profile);
+
+    EXPECT_EQ(profile.get(), &simMotor.getLastProfile());
+    EXPECT_EQ(2, profile.use_count());
+    EXPECT_DOUBLE_EQ(4.0, simMotor.getCurrentRotation());
+}
+
+TEST(SimMotorTest, ExecuteRotationProfileIgnoresNullSharedPointer) {
+    // nullptr 또는 빈 배열 공유 포인터는 아무 동작도 하지 않는다
+    SimMotor simMotor;
+
+    simMotor.executeRotationProfile(
+        std::shared_ptr<const std::vector<double>>());
+    simMotor.executeRotationProfile(
+        std::make_shared<const std::vector<double>>());
+
+    EXPECT_DOUBLE_EQ(0.0, simMotor.getCurrentRotation());
+    EXPECT_TRUE(simMotor.getLastProfile().empty());
+}
+
+TEST(SimMotorTest, LoadProfileOverloadsShareOrMoveBuffer) {
+    // loadProfile()도 rvalue/shared_ptr 전달 시 복사하지 않는다
+    SimMotor simMotor;
+    std::vector<double> moved = {5.0, 6.0};
+    const double *movedBuffer = moved.data();
+    simMotor.loadProfile(std::move(moved));
+    EXPECT_EQ(movedBuffer, simMotor.getLastProfile().data());
+
+    auto shared = std::make_shared<const std::vector<double>>(
+        std::vector<double>{7.0, 8.0});
+    simMotor.loadProfile(shared);
+    EXPECT_EQ(shared.get(), &simMotor.getLastProfile());
+
+    simMotor.startExecution();
+    simMotor.step();
+    simMotor.step();
+    EXPECT_DOUBLE_EQ(8.0, simMotor.getCurrentRotation());
+}
+
+// Phase 15: 배치 스텝 실행
+static std::vector<double> makeRampProfile(size_t samples) {
+    std::vector<double> profile(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        profile[i] = static_cast<double>(i + 1);
+    }
+    return profile;
+}
+
+TEST(SimMotorTest, StepNAdvancesRequestedSamples) {
+    // stepN(n)은 n 샘플을 한 번에 진행하고 진행한 샘플 수를 반환한다
+    SimMotor simMotor;
+    simMotor.loadProfile(makeRampProfile(100));
+    simMotor.startExecution();
+
+    EXPECT_EQ(40u, simMotor.stepN(40));
+    EXPECT_DOUBLE_EQ(40.0, simMotor.getCurrentRotation());
+    EXPECT_NEAR(0.040, simMotor.getElapsedTime(), 1e-12);
+    EXPECT_TRUE(simMotor.isRunning());
+}
+
+TEST(SimMotorTest, StepNStopsAtEndOfProfile) {
+    // 남은 샘플보다 큰 n을 전달하면 프로파일 끝에서 멈춘다
+    SimMotor simMotor;
+    simMotor.loadProfile(makeRampProfile(10));
+    simMotor.startExecution();
+
+    EXPECT_EQ(10u, simMotor.stepN(1000));
+    EXPECT_DOUBLE_EQ(10.0, simMotor.getCurrentRotation());
+    EXPECT_FALSE(simMotor.isRunning());
+    EXPECT_EQ(0u, simMotor.stepN(5));
+}
+
+TEST(SimMotorTest, RunUntilAdvancesToRequestedTime) {
+    // runUntil(t)은 누적 시간이 t에 도달할 때까지 진행한다
+    SimMotor simMotor;
+    simMotor.setControlPeriod(0.004);
+    simMotor.loadProfile(makeRampProfile(1000));
+    simMotor.startExecution();
+
+    EXPECT_EQ(250u, simMotor.runUntil(1.0));
+    EXPECT_DOUBLE_EQ(250.0, simMotor.getCurrentRotation());
+    EXPECT_NEAR(1.0, simMotor.getElapsedTime(), 1e-9);
+
+    // 이미 지난 시간은 진행하지 않는다
+    EXPECT_EQ(0u, simMotor.runUntil(0.5));
+}
+
+TEST(SimMotorTest, StepCallbackIsCalledEveryIntervalSamples) {
+    // 콜백은 interval 샘플마다 호출된다
+    SimMotor simMotor;
+    std::vector<double> observed;
+    simMotor.setStepCallback(
+        [&observed](const SimMotor &motor) {
+            observed.push_back(motor.getCurrentRotation());
+        },
+        25);
+    simMotor.loadProfile(makeRampProfile(100));
+    simMotor.startExecution();
+
+    simMotor.stepN(60);
+    simMotor.stepN(60);
+
+    ASSERT_EQ(4u, observed.size());
+    EXPECT_DOUBLE_EQ(25.0, observed[0]);
+    EXPECT_DOUBLE_EQ(50.0, observed[1]);
+    EXPECT_DOUBLE_EQ(75.0, observed[2]);
+    EXPECT_DOUBLE_EQ(100.0, observed[3]);
+}
+
+TEST(SimMotorTest, StepNStopsWhenCallbackStopsMotor) {
+    // 콜백이 모터를 정지시키면 배치의 남은 샘플을 진행하지 않는다
+    SimMotor simMotor;
+    size_t calls = 0;
+    simMotor.setStepCallback(
+        [&simMotor, &calls](const SimMotor &) {
+            if (++calls == 3) {
+                simMotor.stop();
+            }
+        },
+        10);
+    simMotor.loadProfile(makeRampProfile(100));
+    simMotor.startExecution();
+
+    EXPECT_EQ(30u, simMotor.stepN(100));
+    EXPECT_FALSE(simMotor.isRunning());
+    EXPECT_DOUBLE_EQ(30.0, simMotor.getCurrentRotation());
+    EXPECT_NEAR(0.030, simMotor.getElapsedTime(), 1e-12);
+    EXPECT_EQ(3u, calls);
+}
+
+TEST(SimMotorTest, TimeWarpReachesSameStateAsFullStepping) {
+    // 타임워프 모드는 중간 샘플을 생략하지만 최종 상태는 같다
+    SimMotor fullMotor;
+    SimMotor warpMotor;
+    warpMotor.setTimeWarp(true);
+
+    for (SimMotor *motor : {&fullMotor, &warpMotor}) {
+        motor->loadProfile(makeRampProfile(5000));
+        motor->startExecution();
+        motor->stepN(1234);
+    }
+
+    EXPECT_DOUBLE_EQ(fullMotor.getCurrentRotation(),
+                     warpMotor.getCurrentRotation());
+    EXPECT_DOUBLE_EQ(fullMotor.getElapsedTime(), warpMotor.getElapsedTime());
+}
+
+TEST(SimMotorTest, SteppedExecutionModeDefersProfileExecution) {
+    // STEPPED 모드에서 executeRotationProfile()은 즉시 완료하지 않는다
+    SimMotor simMotor;
+    EXPECT_EQ(SimMotor::ExecutionMode::IMMEDIATE, simMotor.getExecutionMode());
+    simMotor.setExecutionMode(SimMotor::ExecutionMode::STEPPED);
+
+    simMotor.executeRotationProfile(makeRampProfile(20));
+
+    EXPECT_TRUE(simMotor.isRunning());
+    EXPECT_DOUBLE_EQ(0.0, simMotor.getCurrentRotation());
+
+    simMotor.stepN(20);
+    EXPECT_FALSE(simMotor.isRunning());
+    EXPECT_DOUBLE_EQ(20.0, simMotor.getCurrentRotation());
+}
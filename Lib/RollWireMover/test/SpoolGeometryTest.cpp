@@ -0,0 +1,57 @@
+#include "SpoolGeometry.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+// Phase 19.1: 위치 ↔ 회전량 변환
+TEST(SpoolGeometryTest, FullyWoundPositionIsZeroRotation) {
+  // 위치 0(모두 감김)은 회전량 0도이다
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+
+  EXPECT_DOUBLE_EQ(0.0, spool.rotationAtPosition(0.0));
+  EXPECT_GT(spool.rotationAtPosition(5.0), 0.0);
+}
+
+TEST(SpoolGeometryTest, PositionAndRotationAreInverse) {
+  // rotationAtPosition()과 positionAtRotation()은 역함수 관계이다
+  SpoolGeometry spool(0.8, 40.0, 12.0);
+
+  for (double position = 0.0; position <= 12.0; position += 0.75) {
+    double rotation = spool.rotationAtPosition(position);
+    EXPECT_NEAR(position, spool.positionAtRotation(rotation), 1e-9);
+  }
+}
+
+TEST(SpoolGeometryTest, RadiusShrinksAsWireIsPaidOut) {
+  // 와이어를 풀수록 반지름이 작아지며, 모두 풀면 내경 반지름이다
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+
+  EXPECT_NEAR(50.0, spool.radiusAtPosition(5.0), 1e-9);
+  EXPECT_GT(spool.radiusAtPosition(0.0), spool.radiusAtPosition(2.5));
+  EXPECT_GT(spool.radiusAtPosition(2.5), spool.radiusAtPosition(5.0));
+}
+
+TEST(SpoolGeometryTest, RotationPerMeterIsLargerNearCore) {
+  // 코어 쪽(작은 반지름)에서는 같은 거리에 더 많이 회전한다
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+
+  double nearFull = spool.rotationAtPosition(1.0) - spool.rotationAtPosition(0.0);
+  double nearCore = spool.rotationAtPosition(5.0) - spool.rotationAtPosition(4.0);
+  EXPECT_GT(nearCore, nearFull);
+}
+
+TEST(SpoolGeometryTest, BatchPositionsMatchSingleConversion) {
+  // 일괄 변환 결과는 positionAtRotation()과 일치한다
+  SpoolGeometry spool(1.0, 50.0, 5.0);
+  std::vector<double> rotations;
+  for (double position = 0.0; position <= 5.0; position += 0.25) {
+    rotations.push_back(spool.rotationAtPosition(position));
+  }
+  std::vector<double> positions(rotations.size());
+
+  spool.positionsAtRotations(rotations.data(), positions.data(),
+                             rotations.size());
+
+  for (size_t i = 0; i < rotations.size(); ++i) {
+    EXPECT_NEAR(spool.positionAtRotation(rotations[i]), positions[i], 1e-12);
+  }
+}
@@ -0,0 +1,168 @@
+#include "RollWireMover.h"
+#include "SimMotor.h"
+#include "SpoolSnapshot.h"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+
+std::string snapshotPath(const char *name) {
+  std::string path = ::testing::TempDir() + name;
+  std::remove(path.c_str());
+  return path;
+}
+
+SpoolSnapshot sampleSnapshot() {
+  SpoolSnapshot snapshot;
+  snapshot.position = 1.25;
+  snapshot.motorRotation = 812.5;
+  snapshot.wireThickness = 1.0;
+  snapshot.innerRadius = 60.0;
+  snapshot.moveCount = 42;
+  snapshot.settings.constantVelocity = 0.4;
+  snapshot.settings.controlPeriod = 0.002;
+  snapshot.settings.profile = RollWireMover::ProfileType::MINIMUM_TIME;
+  snapshot.settings.planningSpace = RollWireMover::PlanningSpace::ROTATION;
+  return snapshot;
+}
+
+} // namespace
+
+// Phase 27.1: 스냅샷 파일 형식
+TEST(SpoolSnapshotTest, WriteThenReadRoundTrips) {
+  std::string path = snapshotPath("roundtrip.snap");
+  SpoolSnapshot written = sampleSnapshot();
+
+  ASSERT_TRUE(SpoolSnapshotFile::write(path, written, true));
+  SpoolSnapshot read;
+  ASSERT_TRUE(SpoolSnapshotFile::read(path, read));
+
+  EXPECT_DOUBLE_EQ(1.25, read.position);
+  EXPECT_DOUBLE_EQ(812.5, read.motorRotation);
+  EXPECT_DOUBLE_EQ(60.0, read.innerRadius);
+  EXPECT_EQ(42u, read.moveCount);
+  EXPECT_DOUBLE_EQ(0.4, read.settings.constantVelocity);
+  EXPECT_DOUBLE_EQ(0.002, read.settings.controlPeriod);
+  EXPECT_EQ(RollWireMover::ProfileType::MINIMUM_TIME, read.settings.profile);
+  EXPECT_EQ(RollWireMover::PlanningSpace::ROTATION,
+            read.settings.planningSpace);
+
+  // 임시 파일은 rename 후 남지 않는다
+  std::ifstream temporary(path + ".tmp");
+  EXPECT_FALSE(temporary.good());
+}
+
+TEST(SpoolSnapshotTest, DurableWriteSyncsRelativeAndMissingDirectories) {
+  // 디렉터리 없는 상대 경로도 durable 쓰기 후 읽을 수 있고 (상위는 "."),
+  // 없는 디렉터리에는 쓰지 못한다
+  std::string path = "durable_relative.snap";
+  std::remove(path.c_str());
+  ASSERT_TRUE(SpoolSnapshotFile::write(path, sampleSnapshot(), true));
+  SpoolSnapshot read;
+  EXPECT_TRUE(SpoolSnapshotFile::read(path, read));
+  EXPECT_EQ(42u, read.moveCount);
+  std::remove(path.c_str());
+
+  EXPECT_FALSE(SpoolSnapshotFile::write("/nonexistent-directory/durable.snap",
+                                        sampleSnapshot(), true));
+}
+
+TEST(SpoolSnapshotTest, CorruptOrTruncatedFileIsRejected) {
+  // 체크섬이 맞지 않거나 길이가 다른 파일은 읽지 않는다
+  std::string path = snapshotPath("corrupt.snap");
+  uint8_t buffer[SpoolSnapshotFile::ENCODED_SIZE];
+  SpoolSnapshotFile::encode(sampleSnapshot(), buffer);
+
+  buffer[20] ^= 0x01;
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(buffer), sizeof(buffer));
+  }
+  SpoolSnapshot read;
+  EXPECT_FALSE(SpoolSnapshotFile::read(path, read));
+
+  buffer[20] ^= 0x01;
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(buffer), sizeof(buffer) - 1);
+  }
+  EXPECT_FALSE(SpoolSnapshotFile::read(path, read));
+  EXPECT_FALSE(SpoolSnapshotFile::read(path + ".missing", read));
+}
+
+// Phase 27.2: 웜 스타트
+TEST(SpoolSnapshotTest, MoverWritesSnapshotAfterEachCompletedMove) {
+  std::string path = snapshotPath("mover.snap");
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  mover.enableSnapshots(path, false);
+
+  mover.moveTo(1.0);
+  mover.moveTo(2.5);
+  EXPECT_EQ(2u, mover.getSnapshotStats().writes);
+
+  SpoolSnapshot snapshot;
+  ASSERT_TRUE(SpoolSnapshotFile::read(path, snapshot));
+  EXPECT_DOUBLE_EQ(2.5, snapshot.position);
+  EXPECT_DOUBLE_EQ(simMotor.getCurrentRotation(), snapshot.motorRotation);
+  EXPECT_EQ(2u, snapshot.moveCount);
+}
+
+TEST(SpoolSnapshotTest, WarmRestartResumesWithoutHoming) {
+  // 재시작 후 복원한 이동기는 재시작 없이 계속 운전한 이동기와 같게 움직인다
+  std::string path = snapshotPath("restart.snap");
+  SimMotor continuous;
+  RollWireMover::ErrorCode error;
+  RollWireMover reference(1.0, 50.0, &continuous, error);
+  double rotationAtShutdown;
+  {
+    SimMotor beforeRestart;
+    RollWireMover mover(1.0, 50.0, &beforeRestart, error);
+    mover.enableSnapshots(path);
+    mover.setConstantVelocity(0.3);
+    mover.setInnerRadius(70.0);
+    mover.moveTo(1.5);
+    rotationAtShutdown = beforeRestart.getCurrentRotation();
+  }
+  reference.setConstantVelocity(0.3);
+  reference.setInnerRadius(70.0);
+  reference.moveTo(1.5);
+
+  SimMotor afterRestart;
+  afterRestart.restoreRotation(rotationAtShutdown);
+  RollWireMover restored(1.0, 50.0, &afterRestart, error);
+  EXPECT_EQ(RollWireMover::ErrorCode::SUCCESS, restored.restoreSnapshot(path));
+  EXPECT_DOUBLE_EQ(1.5, restored.getCurrentPosition());
+  EXPECT_DOUBLE_EQ(70.0, restored.getInnerRadius());
+  EXPECT_EQ(1u, restored.getStatus().moveCount);
+
+  restored.moveTo(0.5);
+  reference.moveTo(0.5);
+  EXPECT_EQ(reference.getLastVelocityProfile(),
+            restored.getLastVelocityProfile());
+  EXPECT_NEAR(continuous.getCurrentRotation(), afterRestart.getCurrentRotation(),
+              1e-9);
+}
+
+TEST(SpoolSnapshotTest, RestoreRejectsMismatchedMotorOrWire) {
+  // 모터가 꺼져 있는 동안 움직였거나 와이어가 다르면 원점 복귀가 필요하다
+  SimMotor simMotor;
+  RollWireMover::ErrorCode error;
+  RollWireMover mover(1.0, 50.0, &simMotor, error);
+  SpoolSnapshot snapshot = sampleSnapshot();
+
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_SNAPSHOT,
+            mover.restoreSnapshot(snapshot));
+
+  simMotor.restoreRotation(snapshot.motorRotation);
+  snapshot.wireThickness = 2.0;
+  EXPECT_EQ(RollWireMover::ErrorCode::INVALID_SNAPSHOT,
+            mover.restoreSnapshot(snapshot));
+
+  EXPECT_EQ(RollWireMover::ErrorCode::SNAPSHOT_IO_ERROR,
+            mover.restoreSnapshot(snapshotPath("absent.snap")));
+  EXPECT_DOUBLE_EQ(0.0, mover.getCurrentPosition());
+}